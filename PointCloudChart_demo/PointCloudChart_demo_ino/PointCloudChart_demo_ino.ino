@@ -36,34 +36,22 @@ void setup() {
   }
 }
 
+// Each report is formatted into this buffer and sent with a single write
+char json_buffer[10 * 1024];
+mmWaveJsonWriter json(json_buffer, sizeof(json_buffer));
+
 void loop() {
   if (mmWave.update(100)) {
     
     PeopleCounting target_info;
     if (mmWave.getPeopleCountingPointCloud(target_info)) {
       if (target_info.targets.size()>0){
-        Serial.print("{\"timestamp\": ");
-        Serial.print(millis());
-        Serial.print(", \"targets\": [");
-        for (size_t i = 0; i < target_info.targets.size(); i++) {
-          const auto& target = target_info.targets[i];
-    
-          Serial.print("{");
-          Serial.printf("\"target_id\": %zu,", i + 1);
-          Serial.printf("\"x_point\": %.2f,", target.x_point);
-          Serial.printf("\"y_point\": %.2f,", target.y_point);
-          Serial.printf("\"z_point\": %.2f,", target.z_point);
-          Serial.printf("\"dop_index\": %f,", target.dop_index);
-          Serial.printf("\"cluster_index\": %f,", target.cluster_index);
-          Serial.printf("\"move_speed\": %.2f", target.dop_index * 100);
-          Serial.print("}");
-    
-          // Add comma if not the last item
-          if (i < target_info.targets.size() - 1) {
-          Serial.print(",");
-          } 
+        json.clear();
+        mmWaveJsonWrite(json, target_info, millis());
+        json.newline();
+        if (!json.overflow()) {
+          Serial.write(json.data(), json.size());
         }
-        Serial.println("]}");
       }
     }
 
@@ -0,0 +1,67 @@
+#include <Arduino.h>
+
+#include "Seeed_Arduino_mmWave.h"
+
+// If the board is an ESP32, include the HardwareSerial library and create a
+// HardwareSerial object for the mmWave serial communication
+#ifdef ESP32
+#  include <HardwareSerial.h>
+HardwareSerial mmWaveSerial(0);
+#else
+// Otherwise, define mmWaveSerial as Serial1
+#  define mmWaveSerial Serial1
+#endif
+
+SEEED_MR60FDA2 mmWave;
+
+// Connected to the reset pin of the sensor, -1 if it is not
+#define MMWAVE_RST_PIN -1
+
+// Called from update() once the sensor answered and took the settings, or
+// when it did not answer in time
+void onReady(bool ready, const mmWaveBringUpStats& stats, void* context) {
+  if (!ready) {
+    Serial.printf("mmWave not found after %u ms\n", stats.ready_ms);
+    return;
+  }
+  Serial.printf("mmWave up after %u ms, configured after %u ms\n",
+                stats.first_frame_ms, stats.ready_ms);
+  if (stats.unanswered)
+    Serial.printf("%u settings were not answered\n", stats.unanswered);
+}
+
+// Steps of a recovery after the sensor went silent
+void onWatchdog(mmWaveWatchdogEvent event, uint16_t type, uint32_t elapsed_ms,
+                void* context) {
+  static const char* const names[] = {"stalled", "flushed", "restarted",
+                                      "recovered", "failed"};
+  Serial.printf("mmWave link %s after %u ms\n",
+                names[static_cast<uint8_t>(event)], elapsed_ms);
+}
+
+void setup() {
+  Serial.begin(115200);
+
+  // Returns at once, loop() runs while the sensor starts
+  mmWave.setReadyCallback(onReady);
+  mmWave.beginAsync(&mmWaveSerial, 115200, MMWAVE_RST_PIN);
+
+  // Queued, and sent once the sensor has answered
+  mmWave.setUserLog(0);
+  mmWave.setInstallationHeight(2.8f);
+  mmWave.setThreshold(1.0f);
+  mmWave.setSensitivity(15);
+
+  // Recover when nothing came for 3 s: flush, reset, resend the settings
+  mmWave.setWatchdog(3000);
+  mmWave.setWatchdogCallback(onWatchdog);
+}
+
+void loop() {
+  if (mmWave.update(100)) {
+    bool is_human;
+    if (mmWave.getHuman(is_human))
+      Serial.println(is_human ? "someone is there" : "nobody");
+  }
+  // Other work keeps running while the sensor comes up
+}
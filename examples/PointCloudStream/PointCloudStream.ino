@@ -0,0 +1,37 @@
+#include <Arduino.h>
+
+#include "Seeed_Arduino_mmWave.h"
+
+// If the board is an ESP32, include the HardwareSerial library and create a
+// HardwareSerial object for the mmWave serial communication
+#ifdef ESP32
+#  include <HardwareSerial.h>
+HardwareSerial mmWaveSerial(0);
+#else
+// Otherwise, define mmWaveSerial as Serial1
+#  define mmWaveSerial Serial1
+#endif
+
+SEEED_MR60FDA2 mmWave;
+
+// Point clouds are sent as compact binary records, about 9 bytes per point
+// instead of about 150 for JSON. Decode them on the host with
+// extras/host/stream_cat.cpp, see SeeedmmWaveStream.h for the layout.
+mmWaveStreamEncoder encoder;
+PeopleCounting point_cloud;
+
+void setup() {
+  Serial.begin(115200);
+  mmWave.begin(&mmWaveSerial);
+  mmWave.setUserLog(1);
+  mmWaveReserveCloud(point_cloud);  // no heap per cloud with static memory
+}
+
+void loop() {
+  if (mmWave.update(100)) {
+    if (mmWave.getPeopleCountingPointCloud(point_cloud)) {
+      size_t len = encoder.encode(point_cloud, millis());
+      Serial.write(encoder.data(), len);
+    }
+  }
+}
@@ -24,15 +24,15 @@ void setup() {
 }
 
 void loop() {
-  // Check if there is data available from mmWaveSerial
-  while (mmWaveSerial.available() > 0) {
-    char receivedChar = mmWaveSerial.read();
-    Serial.write(receivedChar); // Forward data to Serial
-  }
+  // Forward the traffic between the GUI and the sensor in blocks. The
+  // sensor traffic is also parsed, so the firmware still sees its reports.
+  mmWave.bridge(Serial);
 
-  // Check if there is data available from Serial
-  while (Serial.available() > 0) {
-    char receivedChar = Serial.read();
-    mmWaveSerial.write(receivedChar); // Forward data to mmWaveSerial
+  if (mmWave.processQueuedFrames(0xFFFF, 1)) {
+    bool is_fall;
+    if (mmWave.getFall(is_fall) && is_fall) {
+      // React to a fall here, e.g. drive a GPIO. Printing to Serial would
+      // corrupt the stream the GUI reads.
+    }
   }
-}
\ No newline at end of file
+}
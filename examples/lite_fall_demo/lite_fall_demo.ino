@@ -0,0 +1,31 @@
+#include <Arduino.h>
+#include "Seeed_Arduino_mmWave.h"
+
+// If the board is an ESP32, include the HardwareSerial library and create a
+// HardwareSerial object for the mmWave serial communication
+#ifdef ESP32
+#  include <HardwareSerial.h>
+HardwareSerial mmWaveSerial(0);
+#else
+// Otherwise, define mmWaveSerial as Serial1
+#  define mmWaveSerial Serial1
+#endif
+
+// Only the fall and presence reports are decoded, every other frame type is
+// ignored and its decoder is not linked into the firmware.
+mmWaveDevice<HardwareSerial, mmWaveFallDecoder, mmWavePresenceDecoder> mmWave;
+
+void setup() {
+  Serial.begin(115200);
+  mmWaveSerial.begin(_UART_BAUD);
+  mmWave.begin(&mmWaveSerial);
+}
+
+void loop() {
+  if (mmWave.update()) {
+    bool is_human;
+    if (mmWave.getHuman(is_human)) {
+      Serial.printf("human: %d\tfall: %d\n", is_human, mmWave.getFall());
+    }
+  }
+}
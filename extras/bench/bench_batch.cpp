@@ -0,0 +1,137 @@
+/**
+ * @file bench_batch.cpp
+ * @date  18 October 2026
+ *
+ * @note Host benchmark of the batch record decode kernel.
+ *
+ * @copyright © 2024, Seeed Studio
+ *
+ * @attention Compares mmWaveBatchLoad32() with the per-field path that
+ * SeeedmmWave::extractFloat()/extractU32() used before, and checks that
+ * both produce the same values. Build it once per kernel:
+ *   g++ -std=c++11 -O2 -I../../src bench_batch.cpp \
+ *       ../../src/SeeedmmWaveBatch.cpp ../../src/SeeedmmWaveFrame.cpp \
+ *       -o bench_batch && ./bench_batch
+ * Add -mavx2 for the AVX2 kernel or -DMMWAVE_BATCH_SCALAR for the MCU one.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#include "SeeedmmWaveSchema.h"
+
+typedef mmWaveFallSchema<TypeFallDetection::Report3DPointCloudDetection>
+    FallCloud;
+typedef mmWaveBreathSchema<TypeHeartBreath::Report3DPointCloudDetection>
+    BreathCloud;
+
+#define MAX_POINTS 256
+
+struct Columns {
+  uint32_t field[5][MAX_POINTS];
+};
+
+/* The previous extract*() loads, one field at a time */
+static float extractFloat(const uint8_t* bytes) {
+  return *reinterpret_cast<const float*>(bytes);
+}
+static uint32_t extractU32(const uint8_t* bytes) {
+  return *reinterpret_cast<const uint32_t*>(bytes);
+}
+
+static int32_t perFieldFall(const uint8_t* data, size_t, Columns& out) {
+  int32_t num = static_cast<int32_t>(extractU32(data));
+  data += 4;
+  float* x   = reinterpret_cast<float*>(out.field[1]);
+  float* y   = reinterpret_cast<float*>(out.field[2]);
+  float* z   = reinterpret_cast<float*>(out.field[3]);
+  float* dop = reinterpret_cast<float*>(out.field[4]);
+  for (int32_t i = 0; i < num; i++, data += 20) {
+    out.field[0][i] = extractU32(data);
+    x[i]            = extractFloat(data + 4);
+    y[i]            = extractFloat(data + 8);
+    z[i]            = extractFloat(data + 12);
+    dop[i]          = extractFloat(data + 16);
+  }
+  return num;
+}
+
+static int32_t perFieldBreath(const uint8_t* data, size_t, Columns& out) {
+  int32_t num = static_cast<int32_t>(extractU32(data));
+  data += 4;
+  float* x = reinterpret_cast<float*>(out.field[0]);
+  float* y = reinterpret_cast<float*>(out.field[1]);
+  for (int32_t i = 0; i < num; i++, data += 16) {
+    x[i]            = extractFloat(data);
+    y[i]            = extractFloat(data + 4);
+    out.field[2][i] = extractU32(data + 8);
+    out.field[3][i] = extractU32(data + 12);
+  }
+  return num;
+}
+
+template <class Schema>
+static int32_t batch(const uint8_t* data, size_t data_len, Columns& out) {
+  void* columns[5] = {out.field[0], out.field[1], out.field[2], out.field[3],
+                      out.field[4]};
+  return Schema::decodeColumns(data, data_len, columns, MAX_POINTS);
+}
+
+static std::vector<uint8_t> makePayload(uint32_t count, size_t stride) {
+  // Offset by one byte so the records are unaligned, as in a received frame
+  std::vector<uint8_t> payload(1 + 4 + count * stride);
+  uint8_t* p = payload.data() + 1;
+  memcpy(p, &count, 4);
+  for (size_t i = 4; i < 4 + count * stride; i++) {
+    p[i] = static_cast<uint8_t>(rand());
+  }
+  return payload;
+}
+
+typedef int32_t (*DecodeFn)(const uint8_t*, size_t, Columns&);
+
+static double run(DecodeFn fn, const std::vector<uint8_t>& payload,
+                  int iterations, Columns& out) {
+  uint32_t sink = 0;
+  auto start    = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++) {
+    int32_t num = fn(payload.data() + 1, payload.size() - 1, out);
+    sink += out.field[1][num - 1];
+  }
+  auto stop = std::chrono::steady_clock::now();
+  if (sink == 0x12345678)
+    printf(" ");
+  return std::chrono::duration<double, std::nano>(stop - start).count() /
+         iterations;
+}
+
+static void compare(const char* name, DecodeFn reference, DecodeFn kernel,
+                    size_t stride, size_t num_fields) {
+  const int iterations    = 200000;
+  const uint32_t counts[] = {8, 32, 51, 64, 256};
+
+  for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]); c++) {
+    std::vector<uint8_t> payload = makePayload(counts[c], stride);
+    Columns a, b;
+    double per_field = run(reference, payload, iterations, a);
+    double batched   = run(kernel, payload, iterations, b);
+    for (size_t f = 0; f < num_fields; f++) {
+      if (memcmp(a.field[f], b.field[f], counts[c] * 4) != 0) {
+        printf("%s: field %zu differs at %u points\n", name, f, counts[c]);
+        exit(1);
+      }
+    }
+    printf("%-8s %8u %14.1f %12.1f %8.2fx\n", name, counts[c], per_field,
+           batched, per_field / batched);
+  }
+}
+
+int main() {
+  printf("kernel: %s\n", mmWaveBatchKernel());
+  printf("%-8s %8s %14s %12s %9s\n", "layout", "points", "per-field ns",
+         "batch ns", "speedup");
+  compare("MR60FDA2", perFieldFall, batch<FallCloud>, 20, 5);
+  compare("MR60BHA2", perFieldBreath, batch<BreathCloud>, 16, 4);
+  return 0;
+}
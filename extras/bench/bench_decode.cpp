@@ -0,0 +1,137 @@
+/**
+ * @file bench_decode.cpp
+ * @date  18 October 2026
+ *
+ * @note Host benchmark of the point-cloud decoders.
+ *
+ * @copyright © 2024, Seeed Studio
+ *
+ * @attention Compares the decoders generated from SeeedmmWaveSchema.h with
+ * the hand-written per-field loop they replaced.
+ *
+ * Build and run from this directory:
+ *   g++ -std=c++11 -O2 -I../../src bench_decode.cpp \
+ *       ../../src/SeeedmmWaveFrame.cpp -o bench_decode && ./bench_decode
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#include "SeeedmmWaveSchema.h"
+
+typedef mmWaveFallSchema<TypeFallDetection::Report3DPointCloudDetection>
+    FallCloud;
+typedef mmWaveBreathSchema<TypeHeartBreath::Report3DPointCloudDetection>
+    BreathCloud;
+
+/* The loop SEEED_MR60FDA2::handleType() used before the schema */
+static bool handFallCloud(const uint8_t* data, size_t data_len,
+                          std::vector<TargetN>& out) {
+  int32_t target_num = mmWaveLoadI32(data);
+  data += sizeof(uint32_t);
+
+  std::vector<TargetN> received_targets;
+  received_targets.reserve(target_num);
+  for (int32_t i = 0; i < target_num; i++) {
+    TargetN target;
+    target.cluster_index = mmWaveLoadI32(data);
+    data += sizeof(int32_t);
+    target.x_point = mmWaveLoadFloat(data);
+    data += sizeof(float);
+    target.y_point = mmWaveLoadFloat(data);
+    data += sizeof(float);
+    target.z_point = mmWaveLoadFloat(data);
+    data += sizeof(float);
+    target.dop_index = mmWaveLoadFloat(data);
+    data += sizeof(float);
+    received_targets.push_back(target);
+  }
+  out = std::move(received_targets);
+  (void)data_len;
+  return true;
+}
+
+/* The loop SEEED_MR60BHA2::handleType() used before the schema */
+static bool handBreathCloud(const uint8_t* data, size_t data_len,
+                            std::vector<TargetN>& out) {
+  size_t target_num = mmWaveLoadU32(data);
+  data += sizeof(uint32_t);
+
+  std::vector<TargetN> received_targets;
+  received_targets.reserve(target_num);
+  for (size_t i = 0; i < target_num; i++) {
+    TargetN target;
+    target.x_point = mmWaveLoadFloat(data);
+    data += sizeof(float);
+    target.y_point = mmWaveLoadFloat(data);
+    data += sizeof(float);
+    target.dop_index = mmWaveLoadU32(data);
+    data += sizeof(int32_t);
+    target.cluster_index = mmWaveLoadU32(data);
+    data += sizeof(int32_t);
+    received_targets.push_back(target);
+  }
+  out = std::move(received_targets);
+  (void)data_len;
+  return true;
+}
+
+static std::vector<uint8_t> makePayload(uint32_t count, size_t stride) {
+  // Offset by one byte so the records are unaligned, as in a received frame
+  std::vector<uint8_t> payload(1 + 4 + count * stride);
+  uint8_t* p = payload.data() + 1;
+  memcpy(p, &count, 4);
+  for (size_t i = 4; i < 4 + count * stride; i += 4) {
+    float value = (rand() % 2000 - 1000) / 1000.0f;
+    memcpy(p + i, &value, 4);
+  }
+  return payload;
+}
+
+typedef bool (*DecodeFn)(const uint8_t*, size_t, std::vector<TargetN>&);
+
+/* The best of several rounds, the others are disturbed by the host */
+static double run(DecodeFn fn, const std::vector<uint8_t>& payload,
+                  int iterations) {
+  const int rounds = 5;
+  std::vector<TargetN> out;
+  float sink  = 0;
+  double best = 0;
+  for (int round = 0; round < rounds; round++) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations / rounds; i++) {
+      fn(payload.data() + 1, payload.size() - 1, out);
+      sink += out.empty() ? 0 : out.back().x_point;
+    }
+    auto stop = std::chrono::steady_clock::now();
+    double ns = std::chrono::duration<double, std::nano>(stop - start).count() /
+                (iterations / rounds);
+    if (round == 0 || ns < best)
+      best = ns;
+  }
+  if (sink == 12345.0f)
+    printf(" ");
+  return best;
+}
+
+int main() {
+  const int iterations     = 200000;
+  const uint32_t counts[]  = {1, 8, 32, 51};
+  const size_t num_counts  = sizeof(counts) / sizeof(counts[0]);
+
+  printf("%-8s %8s %12s %12s\n", "layout", "points", "hand ns", "schema ns");
+  for (size_t i = 0; i < num_counts; i++) {
+    std::vector<uint8_t> payload = makePayload(counts[i], 20);
+    printf("%-8s %8u %12.1f %12.1f\n", "MR60FDA2", counts[i],
+           run(handFallCloud, payload, iterations),
+           run(FallCloud::decode, payload, iterations));
+  }
+  for (size_t i = 0; i < num_counts; i++) {
+    std::vector<uint8_t> payload = makePayload(counts[i], 16);
+    printf("%-8s %8u %12.1f %12.1f\n", "MR60BHA2", counts[i],
+           run(handBreathCloud, payload, iterations),
+           run(BreathCloud::decode, payload, iterations));
+  }
+  return 0;
+}
@@ -0,0 +1,160 @@
+/**
+ * @file bench_history.cpp
+ * @date  18 October 2026
+ *
+ * @note Host check and benchmark of mmWaveHistory with synthetic clouds.
+ *
+ * @copyright © 2024, Seeed Studio
+ *
+ * @attention Every stored point carries its order of arrival in dop_index.
+ * The history must always hold the most recent points stored, at most
+ * `max_points` of them, and a query must find exactly the points of that
+ * suffix a brute-force scan finds. Empty clouds, which open slices holding
+ * no point, are mixed in on purpose.
+ *   g++ -std=c++11 -O2 -I../../src bench_history.cpp \
+ *       ../../src/SeeedmmWaveHistory.cpp -o bench_history && ./bench_history
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "SeeedmmWaveHistory.h"
+
+static std::vector<mmWaveHistoryPoint> all;  // every point stored, in order
+
+static bool collect(const mmWaveHistoryPoint& point, void* context) {
+  static_cast<std::vector<uint32_t>*>(context)->push_back(
+      static_cast<uint32_t>(point.dop_index));
+  return true;
+}
+
+static float randomIn(float lo, float hi) {
+  return lo + (hi - lo) * (rand() / static_cast<float>(RAND_MAX));
+}
+
+static void makeCloud(PeopleCounting& cloud, size_t points) {
+  cloud.targets.clear();
+  for (size_t i = 0; i < points; i++) {
+    TargetN target;
+    target.x_point       = randomIn(-3, 3);
+    target.y_point       = randomIn(0, 6);
+    target.z_point       = randomIn(0, 2.5f);
+    target.dop_index     = 0;
+    target.cluster_index = 0;
+    cloud.targets.push_back(target);
+  }
+}
+
+static size_t add(mmWaveHistory& history, uint32_t now,
+                  PeopleCounting& cloud) {
+  for (size_t i = 0; i < cloud.targets.size(); i++) {
+    cloud.targets[i].dop_index = static_cast<float>(all.size() + i);
+  }
+  size_t stored = history.add(now, cloud);
+  for (size_t i = 0; i < stored; i++) {
+    const TargetN& t = cloud.targets[i];
+    all.push_back({t.x_point, t.y_point, t.z_point, t.dop_index,
+                   t.cluster_index, now});
+  }
+  return stored;
+}
+
+/* The history holds the last size() points stored, each found once */
+static bool checkSuffix(const mmWaveHistory& history, size_t max_points) {
+  if (history.size() > max_points) {
+    printf("FAIL: %zu points kept, at most %zu\n", history.size(), max_points);
+    return false;
+  }
+  mmWaveRoiBox everywhere = {-1e9f, 1e9f, -1e9f, 1e9f, -1e9f, 1e9f};
+  std::vector<uint32_t> ids;
+  size_t found = history.box(everywhere, history.oldestMs(),
+                             history.oldestMs() + 0x7FFFFFFFu, collect, &ids);
+  if (found != history.size()) {
+    printf("FAIL: %zu points found, %zu kept\n", found, history.size());
+    return false;
+  }
+  std::vector<bool> seen(history.size(), false);
+  size_t first = all.size() - history.size();
+  for (uint32_t id : ids) {
+    if (id < first || id >= all.size() || seen[id - first]) {
+      printf("FAIL: point %u found, kept are %zu to %zu\n", id, first,
+             all.size() - 1);
+      return false;
+    }
+    seen[id - first] = true;
+  }
+  return true;
+}
+
+int main() {
+  // An empty slice oldest when the ring fills up
+  {
+    mmWaveHistory history;
+    PeopleCounting cloud;
+    history.begin(8, 100, 8);
+    all.clear();
+    const size_t points[] = {0, 4, 4, 1, 3, 0, 0, 5};
+    for (size_t i = 0; i < sizeof(points) / sizeof(points[0]); i++) {
+      makeCloud(cloud, points[i]);
+      add(history, i * 100, cloud);
+      if (!checkSuffix(history, 8))
+        return 1;
+    }
+    printf("empty oldest slice: %zu points kept in %zu slices\n",
+           history.size(), history.sliceCount());
+  }
+
+  // Random clouds, empty ones included, against brute force
+  const size_t max_points = 2048;
+  mmWaveHistory history;
+  PeopleCounting cloud;
+  history.begin(max_points, 500, 16, 0.25f);
+  all.clear();
+  uint32_t now = 0xFFFF0000u;  // wraps during the run
+  for (int frame = 0; frame < 4000; frame++, now += 50) {
+    makeCloud(cloud, rand() % 4 == 0 ? 0 : rand() % 120);
+    add(history, now, cloud);
+    if (!checkSuffix(history, max_points))
+      return 1;
+    if (frame % 50 != 0)
+      continue;
+    float x = randomIn(-3, 3), y = randomIn(0, 6), z = randomIn(0, 2.5f);
+    float r       = randomIn(0.1f, 1.0f);
+    uint32_t from = now - rand() % 6000;
+    std::vector<uint32_t> ids;
+    size_t found = history.radius(x, y, z, r, from, now, collect, &ids);
+    size_t expected = 0;
+    for (size_t i = all.size() - history.size(); i < all.size(); i++) {
+      const mmWaveHistoryPoint& p = all[i];
+      float dx = p.x_point - x, dy = p.y_point - y, dz = p.z_point - z;
+      if (static_cast<int32_t>(p.timestamp_ms - from) >= 0 &&
+          dx * dx + dy * dy + dz * dz <= r * r)
+        expected++;
+    }
+    if (found != expected) {
+      printf("FAIL: radius found %zu points, brute force %zu\n", found,
+             expected);
+      return 1;
+    }
+  }
+  printf("random: %zu points kept, %u dropped\n", history.size(),
+         history.dropped());
+
+  // Query cost on a full history
+  const int iterations = 100000;
+  size_t found         = 0;
+  auto start           = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++) {
+    found += history.radius(randomIn(-3, 3), randomIn(0, 6), 1.0f, 0.5f,
+                            now - 3000, now);
+  }
+  auto stop = std::chrono::steady_clock::now();
+  printf("radius 0.5 m over 3 s, %zu points kept: %.2f us, %.1f found\n",
+         history.size(),
+         std::chrono::duration<double, std::micro>(stop - start).count() /
+             iterations,
+         static_cast<double>(found) / iterations);
+  return 0;
+}
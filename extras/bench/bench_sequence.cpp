@@ -0,0 +1,128 @@
+/**
+ * @file bench_sequence.cpp
+ * @date  19 October 2026
+ *
+ * @note Host check and benchmark of mmWaveSequenceTracker.
+ *
+ * @copyright © 2024, Seeed Studio
+ *
+ * @attention Feeds id patterns with known loss, reordering and module
+ * resets, and checks the counters the tracker reports for each.
+ *   g++ -std=c++11 -O2 -I../../src bench_sequence.cpp \
+ *       ../../src/SeeedmmWaveSequence.cpp -o bench_sequence
+ *   ./bench_sequence
+ */
+
+#include <chrono>
+#include <cstdio>
+
+#include "SeeedmmWaveSequence.h"
+
+static void feed(mmWaveSequenceTracker& tracker, uint16_t type, uint32_t from,
+                 uint32_t to) {
+  for (uint32_t id = from; id < to; id++) {
+    tracker.observe(type, static_cast<uint16_t>(id));
+  }
+}
+
+static bool expect(const char* name, const mmWaveSequenceTracker& tracker,
+                   uint32_t lost, uint32_t gaps, uint32_t reordered,
+                   uint32_t stale, uint32_t resyncs) {
+  const mmWaveSequenceStats& s = tracker.stats();
+  printf("%-28s recv %5u lost %3u gaps %2u dup %u reord %2u stale %3u "
+         "resync %u\n",
+         name, s.received, s.lost, s.gaps, s.duplicates, s.reordered,
+         s.stale, s.resyncs);
+  if (s.lost == lost && s.gaps == gaps && s.reordered == reordered &&
+      s.stale == stale && s.resyncs == resyncs)
+    return true;
+  printf("FAIL: expected lost %u gaps %u reord %u stale %u resync %u\n", lost,
+         gaps, reordered, stale, resyncs);
+  return false;
+}
+
+int main() {
+  bool ok = true;
+
+  // A module reset the library knows about
+  {
+    mmWaveSequenceTracker tracker;
+    feed(tracker, 1, 0, 500);
+    tracker.restart();
+    feed(tracker, 1, 0, 400);
+    ok &= expect("restart()", tracker, 0, 0, 0, 0, 0);
+  }
+
+  // A reset nobody reported, ids start again below the last one
+  {
+    mmWaveSequenceTracker tracker;
+    feed(tracker, 1, 0, 500);
+    feed(tracker, 1, 0, 400);
+    ok &= expect("silent reset", tracker, 0, 0, 0, 0, 1);
+  }
+
+  // Same, with ten ids lost after the reset
+  {
+    mmWaveSequenceTracker tracker;
+    feed(tracker, 1, 0, 500);
+    feed(tracker, 1, 0, 100);
+    feed(tracker, 1, 110, 200);
+    ok &= expect("silent reset, then a gap", tracker, 10, 1, 0, 0, 1);
+  }
+
+  // Old ids now and then are stale, not a reset
+  {
+    mmWaveSequenceTracker tracker;
+    feed(tracker, 1, 0, 100);
+    tracker.observe(1, 10);
+    tracker.observe(1, 50);
+    tracker.observe(1, 20);
+    feed(tracker, 1, 100, 110);
+    ok &= expect("scattered old ids", tracker, 0, 0, 0, 3, 0);
+  }
+
+  // A lost id found late, and one before the first id of its stream
+  {
+    mmWaveSequenceTracker tracker;
+    tracker.observe(1, 100);
+    tracker.observe(1, 102);
+    tracker.observe(1, 99);
+    tracker.observe(1, 101);
+    ok &= expect("late ids", tracker, 0, 1, 2, 0, 0);
+  }
+
+  // A late id of one stream leaves the loss of another alone
+  {
+    mmWaveSequenceTracker tracker;
+    tracker.setScope(mmWaveSequenceScope::PerType);
+    tracker.observe(1, 10);
+    tracker.observe(1, 12);
+    tracker.observe(2, 50);
+    tracker.observe(2, 49);
+    tracker.observe(2, 52);
+    tracker.observe(2, 51);
+    ok &= expect("per type", tracker, 1, 2, 2, 0, 0);
+  }
+
+  // Through the wraparound of the id
+  {
+    mmWaveSequenceTracker tracker;
+    feed(tracker, 1, 65000, 65536 + 500);
+    ok &= expect("wraparound", tracker, 0, 0, 0, 0, 0);
+  }
+
+  if (!ok)
+    return 1;
+
+  const uint32_t frames = 10000000;
+  mmWaveSequenceTracker tracker;
+  auto start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < frames; i++) {
+    tracker.observe(1, static_cast<uint16_t>(i % 97 ? i : i + 1));
+  }
+  auto stop = std::chrono::steady_clock::now();
+  printf("observe(): %.2f ns per frame\n",
+         std::chrono::duration<double, std::nano>(stop - start).count() /
+             frames);
+  return 0;
+}
@@ -0,0 +1,88 @@
+/**
+ * @file Arduino.cpp
+ * @date  18 October 2026
+ *
+ * @note Minimal Arduino core for building the library on a Linux host.
+ *
+ * @copyright © 2024, Seeed Studio
+ */
+
+#include "Arduino.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <time.h>
+
+static uint64_t monotonicMicros() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<uint64_t>(ts.tv_sec) * 1000000 + ts.tv_nsec / 1000;
+}
+
+static const uint64_t kStart = monotonicMicros();
+
+uint32_t millis() {
+  return (monotonicMicros() - kStart) / 1000;
+}
+
+uint32_t micros() {
+  return monotonicMicros() - kStart;
+}
+
+void delay(uint32_t ms) {
+  struct timespec ts = {static_cast<time_t>(ms / 1000),
+                        static_cast<long>(ms % 1000) * 1000000};
+  nanosleep(&ts, nullptr);
+}
+
+size_t Print::print(const char* text) {
+  return write(text, strlen(text));
+}
+
+size_t Print::print(char c) {
+  return write(static_cast<uint8_t>(c));
+}
+
+size_t Print::print(long value, int base) {
+  char text[24];
+  snprintf(text, sizeof(text), base == HEX ? "%lX" : "%ld", value);
+  return print(text);
+}
+
+size_t Print::print(unsigned long value, int base) {
+  char text[24];
+  snprintf(text, sizeof(text), base == HEX ? "%lX" : "%lu", value);
+  return print(text);
+}
+
+size_t Print::print(double value, int digits) {
+  char text[48];
+  snprintf(text, sizeof(text), "%.*f", digits, value);
+  return print(text);
+}
+
+size_t Print::printf(const char* format, ...) {
+  char text[256];
+  va_list args;
+  va_start(args, format);
+  int len = vsnprintf(text, sizeof(text), format, args);
+  va_end(args);
+  if (len < 0)
+    return 0;
+  return write(text, static_cast<size_t>(len) < sizeof(text) ? len
+                                                              : sizeof(text) - 1);
+}
+
+/* Serial is the console */
+class ConsoleSerial : public HardwareSerial {
+ public:
+  size_t write(const uint8_t* buffer, size_t size) override {
+    return fwrite(buffer, 1, size, stdout);
+  }
+  int availableForWrite() override {
+    return 4096;
+  }
+};
+
+static ConsoleSerial console;
+HardwareSerial& Serial = console;
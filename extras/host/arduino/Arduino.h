@@ -0,0 +1,101 @@
+/**
+ * @file Arduino.h
+ * @date  18 October 2026
+ *
+ * @note Minimal Arduino core for building the library on a Linux host.
+ *
+ * @copyright © 2024, Seeed Studio
+ *
+ * @attention Only what the library uses is provided. HardwareSerial does
+ * nothing by itself; a host transport derives from it and overrides
+ * available(), read(), write() and availableForWrite(). Serial prints to
+ * stdout. Used by the soak driver, see soak_update.cpp.
+ */
+
+#ifndef MMWAVE_HOST_ARDUINO_H
+#define MMWAVE_HOST_ARDUINO_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define ESP32 1
+
+#define HEX    16
+#define OUTPUT 1
+#define LOW    0
+#define HIGH   1
+
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+inline void yield() {}
+inline void pinMode(int, int) {}
+inline void digitalWrite(int, int) {}
+
+class Print {
+ public:
+  virtual ~Print() {}
+
+  virtual size_t write(uint8_t c) {
+    return write(&c, 1);
+  }
+  virtual size_t write(const uint8_t* buffer, size_t size) = 0;
+  size_t write(const char* buffer, size_t size) {
+    return write(reinterpret_cast<const uint8_t*>(buffer), size);
+  }
+  virtual int availableForWrite() {
+    return 0;
+  }
+  virtual void flush() {}
+
+  size_t print(const char* text);
+  size_t print(char c);
+  size_t print(long value, int base = 10);
+  size_t print(unsigned long value, int base = 10);
+  size_t print(int value, int base = 10) {
+    return print(static_cast<long>(value), base);
+  }
+  size_t print(unsigned int value, int base = 10) {
+    return print(static_cast<unsigned long>(value), base);
+  }
+  size_t print(double value, int digits = 2);
+  template <class T>
+  size_t println(T value) {
+    return print(value) + print("\r\n");
+  }
+  size_t println() {
+    return print("\r\n");
+  }
+  size_t printf(const char* format, ...)
+      __attribute__((format(printf, 2, 3)));
+};
+
+class Stream : public Print {
+ public:
+  virtual int available() = 0;
+  virtual int read()      = 0;
+  virtual int peek() {
+    return -1;
+  }
+  /* Reads what is available, the host transports never block */
+  virtual size_t readBytes(uint8_t* buffer, size_t length) {
+    size_t count = 0;
+    int c;
+    while (count < length && (c = read()) >= 0) {
+      buffer[count++] = c;
+    }
+    return count;
+  }
+  size_t readBytes(char* buffer, size_t length) {
+    return readBytes(reinterpret_cast<uint8_t*>(buffer), length);
+  }
+  void setTimeout(unsigned long) {}
+};
+
+class HardwareSerial;
+extern HardwareSerial& Serial;
+
+#include "HardwareSerial.h"
+
+#endif /*MMWAVE_HOST_ARDUINO_H*/
@@ -0,0 +1,46 @@
+/**
+ * @file HardwareSerial.h
+ * @date  18 October 2026
+ *
+ * @note Serial port base class of the host Arduino core.
+ *
+ * @copyright © 2024, Seeed Studio
+ */
+
+#ifndef MMWAVE_HOST_HARDWARESERIAL_H
+#define MMWAVE_HOST_HARDWARESERIAL_H
+
+#include "Arduino.h"
+
+class HardwareSerial : public Stream {
+ public:
+  explicit HardwareSerial(int uart = 0) {
+    (void)uart;
+  }
+
+  virtual void begin(unsigned long baud) {
+    (void)baud;
+  }
+  virtual void end() {}
+  size_t setRxBufferSize(size_t size) {
+    return size;
+  }
+  void setRxFIFOFull(uint8_t) {}
+  operator bool() const {
+    return true;
+  }
+
+  int available() override {
+    return 0;
+  }
+  int read() override {
+    return -1;
+  }
+  size_t write(const uint8_t* buffer, size_t size) override {
+    (void)buffer;
+    return size;
+  }
+  using Print::write;
+};
+
+#endif /*MMWAVE_HOST_HARDWARESERIAL_H*/
@@ -0,0 +1,56 @@
+/**
+ * @file host_serial.h
+ * @date  18 October 2026
+ *
+ * @note Serial port setup shared by the host tools.
+ *
+ * @copyright © 2024, Seeed Studio
+ */
+
+#ifndef MMWAVE_HOST_SERIAL_H
+#define MMWAVE_HOST_SERIAL_H
+
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+
+inline speed_t mmWaveHostSpeed(long baud) {
+  switch (baud) {
+    case 9600:
+      return B9600;
+    case 57600:
+      return B57600;
+    case 230400:
+      return B230400;
+    case 460800:
+      return B460800;
+    case 921600:
+      return B921600;
+    default:
+      return B115200;
+  }
+}
+
+/**
+ * @brief Open a serial port or pty in raw mode. Files and pipes that are
+ * not terminals are opened as they are.
+ *
+ * @return The file descriptor, -1 on error with errno set.
+ */
+inline int mmWaveHostOpenSerial(const char* path, long baud, int flags) {
+  int fd = open(path, flags | O_NOCTTY);
+  if (fd < 0)
+    return -1;
+  struct termios tio;
+  if (tcgetattr(fd, &tio) == 0) {
+    cfmakeraw(&tio);
+    cfsetispeed(&tio, mmWaveHostSpeed(baud));
+    cfsetospeed(&tio, mmWaveHostSpeed(baud));
+    tio.c_cc[VMIN]  = 1;
+    tio.c_cc[VTIME] = 0;
+    tcsetattr(fd, TCSANOW, &tio);
+  }
+  return fd;
+}
+
+#endif /*MMWAVE_HOST_SERIAL_H*/
@@ -0,0 +1,584 @@
+/**
+ * @file mmwave_batch.cpp
+ * @date  18 October 2026
+ *
+ * @note Parallel decode of archived UART captures into per-file statistics.
+ *
+ * @copyright © 2024, Seeed Studio
+ *
+ * @attention Each capture is the raw byte stream of an MR60FDA2 or
+ * MR60BHA2. Files are cut into shards of a few megabytes and decoded by a
+ * pool of threads, one SEEED_MR60FDA2 or SEEED_MR60BHA2 per thread, through
+ * the library's own processFrame() and handleType(). Every thread takes
+ * shards from its own deque and steals from the others when it runs dry,
+ * so a few large files keep every core busy. A frame that crosses the end
+ * of a shard is decoded by the shard it starts in.
+ *
+ * One row per file is written to a columnar file (see writeColumns()), read
+ * from Python with mmwave_batch.py:
+ *   file, model, bytes, frames, invalid_frames, unhandled_frames,
+ *   type_0xNNNN for each frame type seen, fall_reports, falls,
+ *   presence_reports, presence_ratio, heart_n/mean/min/max,
+ *   breath_n/mean/min/max, clouds, occupied_clouds, occupancy, mean_points,
+ *   max_points.
+ * Ratios and summaries without data are NaN. invalid_frames may change by
+ * a few with the shard size: a shard that starts inside a payload can take
+ * payload bytes for a header before it finds the first frame.
+ *   g++ -std=gnu++11 -O2 -pthread -Iarduino -I../../src mmwave_batch.cpp \
+ *       arduino/Arduino.cpp ../../src/S*.cpp -o mmwave_batch
+ *   ./mmwave_batch [-j threads] [-s shard MiB] [-m fda2|bha2] \
+ *       [-o out.mwc] capture...
+ */
+
+#include <fcntl.h>
+#include <math.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "Seeed_Arduino_mmWave.h"
+
+enum class Model : uint8_t {
+  Auto,
+  MR60FDA2,
+  MR60BHA2,
+};
+
+struct Summary {
+  uint64_t n = 0;
+  double sum = 0;
+  double min = INFINITY;
+  double max = -INFINITY;
+
+  void add(double value) {
+    n++;
+    sum += value;
+    min = value < min ? value : min;
+    max = value > max ? value : max;
+  }
+  void merge(const Summary& other) {
+    n += other.n;
+    sum += other.sum;
+    min = other.min < min ? other.min : min;
+    max = other.max > max ? other.max : max;
+  }
+  double mean() const {
+    return n ? sum / n : NAN;
+  }
+};
+
+/* Statistics of a shard, merged in file order into those of the file */
+struct Stats {
+  uint64_t bytes            = 0;
+  uint64_t frames           = 0;  // with valid checksums
+  uint64_t invalid_frames   = 0;  // headers whose payload did not validate
+  uint64_t unhandled_frames = 0;  // valid, refused by handleType()
+  std::map<uint16_t, uint64_t> types;
+
+  uint64_t fall_reports = 0;
+  uint64_t falls        = 0;  // reports going from no fall to fall
+  int first_fall        = -1;
+  int last_fall         = -1;
+
+  uint64_t presence_reports = 0;
+  uint64_t presence         = 0;
+
+  Summary heart;
+  Summary breath;
+
+  uint64_t clouds          = 0;
+  uint64_t occupied_clouds = 0;
+  uint64_t points          = 0;
+  uint64_t max_points      = 0;
+
+  void onFall(bool fall) {
+    fall_reports++;
+    if (fall && last_fall == 0)
+      falls++;
+    if (first_fall < 0)
+      first_fall = fall;
+    last_fall = fall;
+  }
+  void onPresence(bool present) {
+    presence_reports++;
+    presence += present;
+  }
+  void onCloud(size_t count) {
+    clouds++;
+    occupied_clouds += count > 0;
+    points += count;
+    max_points = count > max_points ? count : max_points;
+  }
+
+  /* `next` follows this one in the file */
+  void merge(const Stats& next) {
+    bytes += next.bytes;
+    frames += next.frames;
+    invalid_frames += next.invalid_frames;
+    unhandled_frames += next.unhandled_frames;
+    for (const auto& type : next.types) {
+      types[type.first] += type.second;
+    }
+    fall_reports += next.fall_reports;
+    falls += next.falls + (last_fall == 0 && next.first_fall == 1);
+    if (first_fall < 0)
+      first_fall = next.first_fall;
+    if (next.last_fall >= 0)
+      last_fall = next.last_fall;
+    presence_reports += next.presence_reports;
+    presence += next.presence;
+    heart.merge(next.heart);
+    breath.merge(next.breath);
+    clouds += next.clouds;
+    occupied_clouds += next.occupied_clouds;
+    points += next.points;
+    max_points = next.max_points > max_points ? next.max_points : max_points;
+  }
+};
+
+/**
+ * @brief A sensor class fed from memory. Frames are cut by the library's
+ * parser and handled by processFrame(); handleType() is wrapped to collect
+ * what each decoded report says.
+ */
+template <class Sensor>
+class CaptureDecoder : public Sensor {
+ private:
+  Stats* _stats = nullptr;
+  PeopleCounting _cloud;
+
+  void collect(uint16_t type);
+
+ public:
+  bool handleType(uint16_t type, const uint8_t* data,
+                  size_t data_len) override {
+    if (!Sensor::handleType(type, data, data_len))
+      return false;
+    collect(type);
+    return true;
+  }
+
+  /**
+   * @brief Decode the frames that start in [begin, end) of `data`.
+   *
+   * @attention A header whose payload fails the checksum is dropped and the
+   * search resumes on the byte after its SOF, so a shard that starts inside
+   * a payload finds the first real frame.
+   */
+  void decode(const uint8_t* data, size_t size, size_t begin, size_t end,
+              Stats& stats) {
+    mmWaveFrameParser parser;
+    _stats = &stats;
+    stats.bytes += end - begin;
+    for (size_t pos = begin; pos < size; pos++) {
+      if (!parser.push(data[pos]))
+        continue;
+      size_t start = pos + 1 - parser.length();
+      if (start >= end)
+        break;
+      if (!mmWaveValidateFrame(parser.frame(), parser.length())) {
+        stats.invalid_frames++;
+        parser.reset();
+        pos = start;
+        continue;
+      }
+      stats.frames++;
+      stats.types[mmWaveFrameType(parser.frame())]++;
+      if (!this->processFrame(parser.frame(), parser.length()))
+        stats.unhandled_frames++;
+    }
+    _stats = nullptr;
+  }
+};
+
+template <>
+void CaptureDecoder<SEEED_MR60FDA2>::collect(uint16_t type) {
+  switch (static_cast<TypeFallDetection>(type)) {
+    case TypeFallDetection::ReportFallDetection:
+      _stats->onFall(getFall());
+      break;
+    case TypeFallDetection::ReportUnmannedDetection:
+      _stats->onPresence(getHuman());
+      break;
+    case TypeFallDetection::Report3DPointCloudDetection:
+      if (getPeopleCountingPointCloud(_cloud))
+        _stats->onCloud(_cloud.targets.size());
+      break;
+    default:
+      break;
+  }
+}
+
+template <>
+void CaptureDecoder<SEEED_MR60BHA2>::collect(uint16_t type) {
+  float rate;
+  switch (static_cast<TypeHeartBreath>(type)) {
+    case TypeHeartBreath::TypeHeartRate:
+      if (getHeartRate(rate))
+        _stats->heart.add(rate);
+      break;
+    case TypeHeartBreath::TypeBreathRate:
+      if (getBreathRate(rate))
+        _stats->breath.add(rate);
+      break;
+    case TypeHeartBreath::ReportHumanDetection:
+      _stats->onPresence(isHumanDetected());
+      break;
+    case TypeHeartBreath::Report3DPointCloudDetection:
+      if (getPeopleCountingPointCloud(_cloud))
+        _stats->onCloud(_cloud.targets.size());
+      break;
+    default:
+      break;
+  }
+}
+
+struct Capture {
+  std::string path;
+  const uint8_t* data = nullptr;
+  size_t size         = 0;
+  Model model         = Model::Auto;
+  Stats stats;
+};
+
+struct Shard {
+  size_t capture;
+  size_t begin;
+  size_t end;
+  Stats stats;
+};
+
+/* Both models share the cloud and presence types; the others tell them
+ * apart. Without any, the capture is taken as an MR60FDA2. */
+static Model detectModel(const Capture& capture) {
+  mmWaveFrameParser parser;
+  size_t limit = capture.size < (1 << 20) ? capture.size : (1 << 20);
+  for (size_t pos = 0; pos < limit; pos++) {
+    if (!parser.push(capture.data[pos]) ||
+        !mmWaveValidateFrame(parser.frame(), parser.length()))
+      continue;
+    uint16_t type = mmWaveFrameType(parser.frame());
+    if ((type & 0xFF00) == 0x0E00)
+      return Model::MR60FDA2;
+    if (type >= static_cast<uint16_t>(TypeHeartBreath::TypeHeartBreathPhase) &&
+        type <= static_cast<uint16_t>(TypeHeartBreath::TypeHeartBreathDistance))
+      return Model::MR60BHA2;
+  }
+  return Model::MR60FDA2;
+}
+
+/* Work-stealing pool: each worker drains its own deque from the back and
+ * steals from the front of the others. No work is added once started. */
+class ShardPool {
+ private:
+  struct Queue {
+    std::mutex lock;
+    std::deque<size_t> shards;
+  };
+
+  std::vector<Capture>& _captures;
+  std::vector<Shard>& _shards;
+  std::deque<Queue> _queues;
+  std::atomic<uint64_t> _steals{0};
+
+  bool take(size_t worker, size_t& shard) {
+    {
+      Queue& own = _queues[worker];
+      std::lock_guard<std::mutex> guard(own.lock);
+      if (!own.shards.empty()) {
+        shard = own.shards.back();
+        own.shards.pop_back();
+        return true;
+      }
+    }
+    for (size_t i = 1; i < _queues.size(); i++) {
+      Queue& victim = _queues[(worker + i) % _queues.size()];
+      std::lock_guard<std::mutex> guard(victim.lock);
+      if (!victim.shards.empty()) {
+        shard = victim.shards.front();
+        victim.shards.pop_front();
+        _steals++;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void work(size_t worker) {
+    CaptureDecoder<SEEED_MR60FDA2> fall;
+    CaptureDecoder<SEEED_MR60BHA2> breath;
+    size_t index;
+    while (take(worker, index)) {
+      Shard& shard           = _shards[index];
+      const Capture& capture = _captures[shard.capture];
+      if (capture.model == Model::MR60BHA2)
+        breath.decode(capture.data, capture.size, shard.begin, shard.end,
+                      shard.stats);
+      else
+        fall.decode(capture.data, capture.size, shard.begin, shard.end,
+                    shard.stats);
+    }
+  }
+
+ public:
+  ShardPool(std::vector<Capture>& captures, std::vector<Shard>& shards,
+            size_t workers)
+      : _captures(captures), _shards(shards), _queues(workers) {
+    // Neighbouring shards to the same worker, the rest is balanced by
+    // stealing
+    for (size_t i = 0; i < shards.size(); i++) {
+      _queues[i * workers / shards.size()].shards.push_front(i);
+    }
+  }
+
+  void run() {
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < _queues.size(); i++) {
+      threads.emplace_back(&ShardPool::work, this, i);
+    }
+    work(0);
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+
+  uint64_t steals() const {
+    return _steals;
+  }
+};
+
+/**
+ * @brief Columnar output, little-endian:
+ *   "MWCB", u32 version 1, u32 columns, u64 rows,
+ *   per column: u16 name length, name, u8 kind ('u' u64, 'f' f64, 's' text),
+ *   then per column its rows: 8 bytes each, or u32 length and the bytes of
+ *   each text.
+ */
+class ColumnWriter {
+ private:
+  struct Column {
+    std::string name;
+    char kind;
+    std::vector<uint8_t> data;
+  };
+  std::vector<Column> _columns;
+  uint64_t _rows = 0;
+
+  static void put(std::vector<uint8_t>& out, uint64_t value, size_t bytes) {
+    for (size_t i = 0; i < bytes; i++) {
+      out.push_back(static_cast<uint8_t>(value >> (8 * i)));
+    }
+  }
+
+  Column& column(const std::string& name, char kind) {
+    for (auto& column : _columns) {
+      if (column.name == name)
+        return column;
+    }
+    _columns.push_back(Column{name, kind, {}});
+    return _columns.back();
+  }
+
+ public:
+  void setRows(uint64_t rows) {
+    _rows = rows;
+  }
+  void add(const std::string& name, uint64_t value) {
+    put(column(name, 'u').data, value, 8);
+  }
+  void add(const std::string& name, double value) {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    put(column(name, 'f').data, bits, 8);
+  }
+  void add(const std::string& name, const std::string& value) {
+    std::vector<uint8_t>& data = column(name, 's').data;
+    put(data, value.size(), 4);
+    data.insert(data.end(), value.begin(), value.end());
+  }
+
+  bool write(const char* path) const {
+    std::vector<uint8_t> header;
+    header.insert(header.end(), {'M', 'W', 'C', 'B'});
+    put(header, 1, 4);
+    put(header, _columns.size(), 4);
+    put(header, _rows, 8);
+    for (const auto& column : _columns) {
+      put(header, column.name.size(), 2);
+      header.insert(header.end(), column.name.begin(), column.name.end());
+      header.push_back(column.kind);
+    }
+    FILE* out = fopen(path, "wb");
+    if (!out)
+      return false;
+    bool ok = fwrite(header.data(), 1, header.size(), out) == header.size();
+    for (const auto& column : _columns) {
+      ok = ok && fwrite(column.data.data(), 1, column.data.size(), out) ==
+                     column.data.size();
+    }
+    return fclose(out) == 0 && ok;
+  }
+};
+
+static void writeColumns(ColumnWriter& out,
+                         const std::vector<Capture>& captures) {
+  std::map<uint16_t, bool> seen;
+  for (const auto& capture : captures) {
+    for (const auto& type : capture.stats.types) {
+      seen[type.first] = true;
+    }
+  }
+  out.setRows(captures.size());
+  for (const auto& capture : captures) {
+    const Stats& s = capture.stats;
+    out.add("file", capture.path);
+    out.add("model", std::string(capture.model == Model::MR60BHA2 ? "MR60BHA2"
+                                                                  : "MR60FDA2"));
+    out.add("bytes", s.bytes);
+    out.add("frames", s.frames);
+    out.add("invalid_frames", s.invalid_frames);
+    out.add("unhandled_frames", s.unhandled_frames);
+    for (const auto& type : seen) {
+      char name[16];
+      snprintf(name, sizeof(name), "type_0x%04X", type.first);
+      auto found = s.types.find(type.first);
+      out.add(name, found == s.types.end() ? uint64_t(0) : found->second);
+    }
+    out.add("fall_reports", s.fall_reports);
+    out.add("falls", s.falls);
+    out.add("presence_reports", s.presence_reports);
+    out.add("presence_ratio", s.presence_reports
+                                  ? double(s.presence) / s.presence_reports
+                                  : NAN);
+    const Summary* vitals[]   = {&s.heart, &s.breath};
+    const char* const names[] = {"heart", "breath"};
+    for (size_t i = 0; i < 2; i++) {
+      std::string prefix = names[i];
+      out.add(prefix + "_n", vitals[i]->n);
+      out.add(prefix + "_mean", vitals[i]->mean());
+      out.add(prefix + "_min", vitals[i]->n ? vitals[i]->min : NAN);
+      out.add(prefix + "_max", vitals[i]->n ? vitals[i]->max : NAN);
+    }
+    out.add("clouds", s.clouds);
+    out.add("occupied_clouds", s.occupied_clouds);
+    out.add("occupancy",
+            s.clouds ? double(s.occupied_clouds) / s.clouds : NAN);
+    out.add("mean_points", s.clouds ? double(s.points) / s.clouds : NAN);
+    out.add("max_points", s.max_points);
+  }
+}
+
+static void usage(const char* self) {
+  fprintf(stderr,
+          "usage: %s [-j threads] [-s shard MiB] [-m fda2|bha2] "
+          "[-o out.mwc] capture...\n",
+          self);
+}
+
+int main(int argc, char** argv) {
+  size_t workers     = std::thread::hardware_concurrency();
+  size_t shard_bytes = 4 << 20;
+  Model model        = Model::Auto;
+  const char* output = "batch.mwc";
+  int opt;
+  while ((opt = getopt(argc, argv, "j:s:m:o:")) != -1) {
+    switch (opt) {
+      case 'j':
+        workers = atoi(optarg);
+        break;
+      case 's':
+        shard_bytes = static_cast<size_t>(atof(optarg) * (1 << 20));
+        break;
+      case 'm':
+        model = strcmp(optarg, "bha2") == 0 ? Model::MR60BHA2 : Model::MR60FDA2;
+        break;
+      case 'o':
+        output = optarg;
+        break;
+      default:
+        usage(argv[0]);
+        return 2;
+    }
+  }
+  if (optind >= argc) {
+    usage(argv[0]);
+    return 2;
+  }
+  if (workers == 0)
+    workers = 1;
+  if (shard_bytes < MMWAVE_MAX_FRAME_SIZE)
+    shard_bytes = MMWAVE_MAX_FRAME_SIZE;
+
+  std::vector<Capture> captures;
+  std::vector<Shard> shards;
+  for (int i = optind; i < argc; i++) {
+    Capture capture;
+    capture.path = argv[i];
+    int fd       = open(argv[i], O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0) {
+      perror(argv[i]);
+      return 1;
+    }
+    capture.size = st.st_size;
+    if (capture.size > 0) {
+      void* map = mmap(nullptr, capture.size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (map == MAP_FAILED) {
+        perror(argv[i]);
+        return 1;
+      }
+      capture.data = static_cast<const uint8_t*>(map);
+    }
+    close(fd);
+    capture.model = model == Model::Auto ? detectModel(capture) : model;
+    for (size_t begin = 0; begin < capture.size; begin += shard_bytes) {
+      size_t end = begin + shard_bytes < capture.size ? begin + shard_bytes
+                                                      : capture.size;
+      shards.push_back(Shard{captures.size(), begin, end, Stats()});
+    }
+    captures.push_back(capture);
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  ShardPool pool(captures, shards, workers);
+  if (!shards.empty())
+    pool.run();
+  double seconds = std::chrono::duration<double>(
+                       std::chrono::steady_clock::now() - start)
+                       .count();
+
+  // Shards are in file order
+  uint64_t bytes = 0;
+  for (const auto& shard : shards) {
+    captures[shard.capture].stats.merge(shard.stats);
+    bytes += shard.stats.bytes;
+  }
+
+  ColumnWriter out;
+  writeColumns(out, captures);
+  if (!out.write(output)) {
+    perror(output);
+    return 1;
+  }
+  fprintf(stderr,
+          "%zu files, %zu shards, %.1f MiB in %.3f s (%.0f MiB/s) on %zu "
+          "threads, %llu steals\n",
+          captures.size(), shards.size(), bytes / 1048576.0, seconds,
+          bytes / 1048576.0 / seconds, workers,
+          static_cast<unsigned long long>(pool.steals()));
+  for (const auto& capture : captures) {
+    if (capture.data)
+      munmap(const_cast<uint8_t*>(capture.data), capture.size);
+  }
+  return 0;
+}
@@ -0,0 +1,60 @@
+"""Reader for the columnar statistics written by mmwave_batch.
+
+The layout is described in mmwave_batch.cpp. Numbers come back as
+array.array columns, text as lists, one entry per capture file:
+
+    columns = read_columns("batch.mwc")
+    for path, falls in zip(columns["file"], columns["falls"]):
+        print(path, falls)
+
+pandas.DataFrame(read_columns(path)) turns it into a table.
+"""
+
+import array
+import struct
+import sys
+
+BATCH_MAGIC = b"MWCB"
+BATCH_VERSION = 1
+
+_HEADER = struct.Struct("<4sIIQ")
+
+
+def read_columns(path):
+    """Return {name: column}, in the order of the file."""
+    with open(path, "rb") as f:
+        data = f.read()
+    magic, version, count, rows = _HEADER.unpack_from(data, 0)
+    if magic != BATCH_MAGIC or version != BATCH_VERSION:
+        raise ValueError("not an mmwave_batch file, or a different version")
+    offset = _HEADER.size
+    layout = []
+    for _ in range(count):
+        (length,) = struct.unpack_from("<H", data, offset)
+        name = data[offset + 2:offset + 2 + length].decode()
+        kind = chr(data[offset + 2 + length])
+        layout.append((name, kind))
+        offset += 3 + length
+
+    columns = {}
+    for name, kind in layout:
+        if kind == "s":
+            values = []
+            for _ in range(rows):
+                (length,) = struct.unpack_from("<I", data, offset)
+                values.append(data[offset + 4:offset + 4 + length].decode())
+                offset += 4 + length
+        else:
+            values = array.array("Q" if kind == "u" else "d")
+            values.frombytes(data[offset:offset + 8 * rows])
+            if sys.byteorder != "little":
+                values.byteswap()
+            offset += 8 * rows
+        columns[name] = values
+    return columns
+
+
+if __name__ == "__main__":
+    columns = read_columns(sys.argv[1] if len(sys.argv) > 1 else "batch.mwc")
+    for name, values in columns.items():
+        print(name, list(values))
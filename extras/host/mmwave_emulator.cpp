@@ -0,0 +1,138 @@
+/**
+ * @file mmwave_emulator.cpp
+ * @date  18 October 2026
+ *
+ * @note Serve an emulated MR60FDA2 or MR60BHA2 on a pty.
+ *
+ * @copyright © 2024, Seeed Studio
+ *
+ * @attention Prints the pty path, e.g. /dev/pts/5, which any tool that
+ * expects the radar can open: mmwave_shmd, the Python demos or a bridge.
+ * Output is paced to the given baud rate, 0 sends as fast as the reader
+ * takes it.
+ *   g++ -std=c++11 -O2 -I../../src mmwave_emulator.cpp \
+ *       ../../src/SeeedmmWaveFrame.cpp -o mmwave_emulator
+ *   ./mmwave_emulator [-m fda2|bha2] [-c cloud_hz] [-s state_hz]
+ *       [-t targets] [-x corrupt_ratio] [-l latency_ms] [-b baud] [-a]
+ *   -a reports point clouds without waiting for the user log command.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <cstdio>
+
+#include "mmwave_emulator.h"
+
+static volatile sig_atomic_t stop = 0;
+
+static void onSignal(int) {
+  stop = 1;
+}
+
+static uint64_t nowMs() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<uint64_t>(ts.tv_sec) * 1000 + ts.tv_nsec / 1000000;
+}
+
+int main(int argc, char** argv) {
+  mmWaveEmulatorConfig config;
+  long baud = 115200;
+  int option;
+  while ((option = getopt(argc, argv, "m:c:s:t:x:l:b:a")) != -1) {
+    switch (option) {
+      case 'm':
+        config.model = optarg[0] == 'b' ? mmWaveEmulatedModel::MR60BHA2
+                                        : mmWaveEmulatedModel::MR60FDA2;
+        break;
+      case 'c':
+        config.cloud_hz = atof(optarg);
+        break;
+      case 's':
+        config.state_hz = atof(optarg);
+        break;
+      case 't':
+        config.targets = atoi(optarg);
+        break;
+      case 'x':
+        config.corrupt_ratio = atof(optarg);
+        break;
+      case 'l':
+        config.latency_ms = atoi(optarg);
+        break;
+      case 'b':
+        baud = atol(optarg);
+        break;
+      case 'a':
+        config.require_user_log = false;
+        break;
+      default:
+        return 2;
+    }
+  }
+
+  int master = posix_openpt(O_RDWR | O_NOCTTY);
+  if (master < 0 || grantpt(master) != 0 || unlockpt(master) != 0) {
+    perror("pty");
+    return 1;
+  }
+  // Raw, so the line discipline does not touch the frames
+  struct termios tio;
+  tcgetattr(master, &tio);
+  cfmakeraw(&tio);
+  tcsetattr(master, TCSANOW, &tio);
+  fcntl(master, F_SETFL, O_NONBLOCK);
+  printf("%s\n", ptsname(master));
+  fflush(stdout);
+
+  signal(SIGINT, onSignal);
+  signal(SIGTERM, onSignal);
+
+  mmWaveEmulator emulator(config);
+  uint8_t chunk[4096];
+  uint64_t start = nowMs(), sent = 0;
+  while (!stop) {
+    struct pollfd fds = {master, POLLIN, 0};
+    poll(&fds, 1, 1);
+    ssize_t n = read(master, chunk, sizeof(chunk));
+    if (n > 0)
+      emulator.receive(chunk, n, nowMs());
+
+    uint64_t now = nowMs();
+    emulator.advance(now);
+    // Bytes the UART would have sent by now, 10 bits per byte
+    size_t budget = sizeof(chunk);
+    if (baud > 0) {
+      uint64_t allowed = (now - start) * baud / 10000;
+      budget = allowed > sent ? allowed - sent : 0;
+      if (budget > sizeof(chunk))
+        budget = sizeof(chunk);
+    }
+    size_t len = emulator.read(chunk, budget);
+    size_t off = 0;
+    while (off < len && !stop) {
+      ssize_t w = write(master, chunk + off, len - off);
+      if (w > 0)
+        off += w;
+      else if (errno == EAGAIN)
+        poll(nullptr, 0, 1);  // no reader or reader too slow
+      else
+        break;
+    }
+    sent += len;
+  }
+
+  const mmWaveEmulatorStats& stats = emulator.stats();
+  fprintf(stderr, "frames %llu corrupted %llu commands %llu\n",
+          static_cast<unsigned long long>(stats.frames),
+          static_cast<unsigned long long>(stats.corrupted),
+          static_cast<unsigned long long>(stats.commands));
+  return 0;
+}
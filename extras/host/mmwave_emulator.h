@@ -0,0 +1,399 @@
+/**
+ * @file mmwave_emulator.h
+ * @date  18 October 2026
+ *
+ * @note Software MR60FDA2 / MR60BHA2 for load and soak testing.
+ *
+ * @attention The emulator produces the frames of the real modules, built
+ * with mmWaveBuildFrame() so the header and checksums are those the parser
+ * expects, at configurable rates and target counts. Frames can be corrupted
+ * on purpose: a flipped bit, a lost byte, a truncated frame or inserted
+ * noise. Commands sent by the host are parsed and answered after the
+ * configured latency, like the MR60FDA2 answers InstallationHeight,
+ * FallThreshold, FallSensitivity, AlarmParameters and RadarParameters. As
+ * on the module, point clouds are only reported once the user log is
+ * enabled, unless `require_user_log` is cleared.
+ *
+ * The emulator is driven by the caller's clock: receive() takes the host
+ * bytes, advance() generates what is due and read() hands out the bytes the
+ * module would send. mmwave_emulator.cpp attaches it to a pty,
+ * soak_update.cpp to an in-memory serial port.
+ *
+ * @copyright © 2024, Seeed Studio
+ */
+
+#ifndef MMWAVE_HOST_EMULATOR_H
+#define MMWAVE_HOST_EMULATOR_H
+
+#include <math.h>
+
+#include <deque>
+#include <random>
+#include <vector>
+
+#include "SeeedmmWaveFrame.h"
+#include "SeeedmmWaveSchema.h"
+
+enum class mmWaveEmulatedModel : uint8_t {
+  MR60FDA2,
+  MR60BHA2,
+};
+
+struct mmWaveEmulatorConfig {
+  mmWaveEmulatedModel model = mmWaveEmulatedModel::MR60FDA2;
+  double cloud_hz           = 10;  // point clouds per second, 0 for none
+  double state_hz           = 1;   // presence, fall, breath and heart reports
+  uint16_t targets          = 8;   // points per cloud
+  double fall_ratio         = 0.05;  // share of fall reports that are falls
+  double corrupt_ratio      = 0;     // share of frames that get corrupted
+  uint32_t latency_ms       = 5;     // delay of command responses
+  bool require_user_log     = true;
+  size_t rx_buffer          = 0;  // receive buffer of the host, 0: unbounded
+  uint32_t seed             = 1;
+};
+
+struct mmWaveEmulatorStats {
+  uint64_t frames;     // frames generated, including corrupted ones
+  uint64_t corrupted;  // frames that were corrupted
+  uint64_t clouds;     // intact point clouds
+  uint64_t falls;      // intact fall reports with a fall
+  uint64_t commands;   // host commands answered
+  uint64_t overrun;    // bytes lost to a full receive buffer
+};
+
+class mmWaveEmulator {
+ private:
+  struct Response {
+    uint64_t due_ms;
+    std::vector<uint8_t> frame;
+  };
+
+  mmWaveEmulatorConfig _config;
+  std::mt19937 _rng;
+  mmWaveFrameParser _parser;
+  std::deque<Response> _responses;
+  std::vector<uint8_t> _out;
+  size_t _out_head = 0;
+  uint8_t _frame[MMWAVE_MAX_FRAME_SIZE];
+  uint8_t _payload[MMWAVE_MAX_FRAME_DATA];
+  uint16_t _id = 0;
+
+  bool _started        = false;
+  uint64_t _start_ms   = 0;
+  uint64_t _cloud_due  = 0;  // clouds generated since start
+  uint64_t _state_due  = 0;  // state reports generated since start
+  bool _user_log       = false;
+  mmWaveEmulatorStats _stats = {};
+
+  FallRadarParameters _parameters;
+
+  double uniform(double lo, double hi) {
+    return std::uniform_real_distribution<double>(lo, hi)(_rng);
+  }
+
+  static void storeU32(uint8_t* out, uint32_t value) {
+    memcpy(out, &value, sizeof(value));  // the host is little-endian
+  }
+  static void storeF32(uint8_t* out, float value) {
+    memcpy(out, &value, sizeof(value));
+  }
+
+  size_t build(uint16_t type, const uint8_t* data, size_t len) {
+    return mmWaveBuildFrame(_frame, sizeof(_frame), _id++, type, data, len);
+  }
+
+  void emit(uint16_t type, const uint8_t* data, size_t len) {
+    _stats.frames++;
+    size_t size = SIZE_FRAME_HEADER + len + (len ? SIZE_DATA_CKSUM : 0);
+    if (_config.rx_buffer && pending() >= _config.rx_buffer) {
+      _stats.overrun += size;  // the receiver is full, spare building it
+      _id++;
+      return;
+    }
+    build(type, data, len);
+    if (_config.corrupt_ratio > 0 && uniform(0, 1) < _config.corrupt_ratio) {
+      corrupt(size);
+      return;
+    }
+    append(_frame, size);
+  }
+
+  /* Bytes beyond the receive buffer are lost, as when a UART overruns */
+  void append(const uint8_t* bytes, size_t len) {
+    size_t room = len;
+    if (_config.rx_buffer && pending() + len > _config.rx_buffer) {
+      room = _config.rx_buffer > pending() ? _config.rx_buffer - pending() : 0;
+      _stats.overrun += len - room;
+    }
+    _out.insert(_out.end(), bytes, bytes + room);
+  }
+
+  void corrupt(size_t size) {
+    _stats.corrupted++;
+    size_t at = std::uniform_int_distribution<size_t>(0, size - 1)(_rng);
+    switch (std::uniform_int_distribution<int>(0, 3)(_rng)) {
+      case 0:  // flipped bit
+        _frame[at] ^= 1 << (at % 8);
+        append(_frame, size);
+        break;
+      case 1:  // lost byte
+        append(_frame, at);
+        append(_frame + at + 1, size - at - 1);
+        break;
+      case 2:  // truncated
+        append(_frame, at);
+        break;
+      default:  // line noise before the frame
+        for (size_t i = 0; i < 1 + at % 16; i++) {
+          uint8_t noise = std::uniform_int_distribution<int>(0, 255)(_rng);
+          append(&noise, 1);
+        }
+        append(_frame, size);
+        break;
+    }
+  }
+
+  void emitCloud(uint16_t type) {
+    bool fall     = _config.model == mmWaveEmulatedModel::MR60FDA2;
+    size_t stride = fall ? 20 : 16;
+    size_t count  = _config.targets;
+    if (4 + count * stride > MMWAVE_MAX_FRAME_DATA)
+      count = (MMWAVE_MAX_FRAME_DATA - 4) / stride;
+
+    storeU32(_payload, count);
+    uint8_t* point = _payload + 4;
+    for (size_t i = 0; i < count; i++, point += stride) {
+      float x = uniform(-1.5, 1.5), y = uniform(0.3, 4.0);
+      float z = uniform(-1.0, 1.0), dop = uniform(-0.5, 0.5);
+      if (fall) {
+        storeU32(point, i % 4);  // cluster
+        storeF32(point + 4, x);
+        storeF32(point + 8, y);
+        storeF32(point + 12, z);
+        storeF32(point + 16, dop);
+      } else {
+        // the MR60BHA2 sends doppler and cluster as integers
+        storeF32(point, x);
+        storeF32(point + 4, y);
+        storeU32(point + 8, static_cast<int32_t>(dop * 10));
+        storeU32(point + 12, i % 4);
+      }
+    }
+    uint64_t corrupted = _stats.corrupted;
+    emit(type, _payload, 4 + count * stride);
+    if (_stats.corrupted == corrupted &&
+        type == static_cast<uint16_t>(
+                    TypeFallDetection::Report3DPointCloudDetection))
+      _stats.clouds++;
+  }
+
+  void emitState() {
+    uint8_t flag = 1;
+    if (_config.model == mmWaveEmulatedModel::MR60FDA2) {
+      emit(static_cast<uint16_t>(TypeFallDetection::ReportUnmannedDetection),
+           &flag, 1);
+      flag               = uniform(0, 1) < _config.fall_ratio;
+      uint64_t corrupted = _stats.corrupted;
+      emit(static_cast<uint16_t>(TypeFallDetection::ReportFallDetection),
+           &flag, 1);
+      if (flag && _stats.corrupted == corrupted)
+        _stats.falls++;
+      return;
+    }
+
+    emit(static_cast<uint16_t>(TypeHeartBreath::ReportHumanDetection), &flag,
+         1);
+    double t = (_state_due % 1000) * 0.1;
+    storeF32(_payload, sin(t) + 0.1 * sin(7 * t));
+    storeF32(_payload + 4, sin(t));
+    storeF32(_payload + 8, 0.1 * sin(7 * t));
+    emit(static_cast<uint16_t>(TypeHeartBreath::TypeHeartBreathPhase),
+         _payload, 12);
+    storeF32(_payload, uniform(12, 20));
+    emit(static_cast<uint16_t>(TypeHeartBreath::TypeBreathRate), _payload,
+         4);
+    storeF32(_payload, uniform(60, 90));
+    emit(static_cast<uint16_t>(TypeHeartBreath::TypeHeartRate), _payload, 4);
+    storeU32(_payload, 1);
+    storeF32(_payload + 4, uniform(0.5, 1.5));
+    emit(static_cast<uint16_t>(TypeHeartBreath::TypeHeartBreathDistance),
+         _payload, 8);
+  }
+
+  void respond(uint64_t now_ms, uint16_t id, uint16_t type,
+               const uint8_t* data, size_t len) {
+    size_t size = mmWaveBuildFrame(_frame, sizeof(_frame), id, type, data, len);
+    _responses.push_back({now_ms + _config.latency_ms,
+                          std::vector<uint8_t>(_frame, _frame + size)});
+    _stats.commands++;
+  }
+
+  void command(uint64_t now_ms, const uint8_t* frame) {
+    uint16_t id         = mmWaveFrameId(frame);
+    uint16_t type       = mmWaveFrameType(frame);
+    uint16_t len        = mmWaveFrameDataLength(frame);
+    const uint8_t* data = frame + SIZE_FRAME_HEADER;
+    uint8_t ok          = 1;
+
+    switch (static_cast<TypeFallDetection>(type)) {
+      case TypeFallDetection::UserLogInfo:
+        _user_log = len >= 1 && data[0] != 0;
+        return;  // not acknowledged by the module
+      case TypeFallDetection::RadarInitSetting:
+        resetParameters();
+        return;
+      default:
+        break;
+    }
+    if (_config.model != mmWaveEmulatedModel::MR60FDA2)
+      return;
+
+    switch (static_cast<TypeFallDetection>(type)) {
+      case TypeFallDetection::InstallationHeight:
+        ok = len == 4;
+        if (ok)
+          _parameters.height = mmWaveLoadFloat(data);
+        break;
+      case TypeFallDetection::FallThreshold:
+        ok = len == 4;
+        if (ok)
+          _parameters.threshold = mmWaveLoadFloat(data);
+        break;
+      case TypeFallDetection::FallSensitivity:
+        ok = len == 4;
+        if (ok)
+          _parameters.sensitivity = mmWaveLoadU32(data);
+        break;
+      case TypeFallDetection::AlarmParameters:
+        ok = len == 16;
+        if (ok) {
+          _parameters.rect_XL = mmWaveLoadFloat(data);
+          _parameters.rect_XR = mmWaveLoadFloat(data + 4);
+          _parameters.rect_ZF = mmWaveLoadFloat(data + 8);
+          _parameters.rect_ZB = mmWaveLoadFloat(data + 12);
+        }
+        break;
+      case TypeFallDetection::RadarParameters:
+        storeF32(_payload, _parameters.height);
+        storeF32(_payload + 4, _parameters.threshold);
+        storeU32(_payload + 8, _parameters.sensitivity);
+        storeF32(_payload + 12, _parameters.rect_XL);
+        storeF32(_payload + 16, _parameters.rect_XR);
+        storeF32(_payload + 20, _parameters.rect_ZF);
+        storeF32(_payload + 24, _parameters.rect_ZB);
+        respond(now_ms, id, type, _payload, 28);
+        return;
+      default:
+        return;  // unknown commands are ignored, as by the module
+    }
+    respond(now_ms, id, type, &ok, 1);
+  }
+
+  void resetParameters() {
+    _parameters.height      = 2.2f;
+    _parameters.threshold   = 0.6f;
+    _parameters.sensitivity = 3;
+    _parameters.rect_XL     = 0.5f;
+    _parameters.rect_XR     = 0.5f;
+    _parameters.rect_ZF     = 0.5f;
+    _parameters.rect_ZB     = 0.5f;
+  }
+
+ public:
+  explicit mmWaveEmulator(const mmWaveEmulatorConfig& config = {})
+      : _config(config), _rng(config.seed) {
+    resetParameters();
+  }
+
+  /**
+   * @brief Change the report rates, counted from `now_ms`.
+   */
+  void setRates(double cloud_hz, double state_hz, uint64_t now_ms) {
+    _config.cloud_hz = cloud_hz;
+    _config.state_hz = state_hz;
+    _started         = true;
+    _start_ms        = now_ms;
+    _cloud_due       = 0;
+    _state_due       = 0;
+  }
+
+  /**
+   * @brief Take bytes sent by the host.
+   */
+  void receive(const uint8_t* data, size_t len, uint64_t now_ms) {
+    for (size_t i = 0; i < len; i++) {
+      if (_parser.push(data[i])) {
+        if (mmWaveValidateFrame(_parser.frame(), _parser.length()))
+          command(now_ms, _parser.frame());
+      } else if (_parser.inFrame() && _parser.length() == SIZE_FRAME_HEADER &&
+                 mmWaveFrameDataLength(_parser.frame()) == 0) {
+        // A query without payload has no data checksum, see send()
+        command(now_ms, _parser.frame());
+        _parser.reset();
+      }
+    }
+  }
+
+  /**
+   * @brief Generate the reports and responses due at `now_ms`.
+   */
+  void advance(uint64_t now_ms) {
+    if (!_started) {
+      _started  = true;
+      _start_ms = now_ms;
+    }
+    while (!_responses.empty() && _responses.front().due_ms <= now_ms) {
+      const std::vector<uint8_t>& frame = _responses.front().frame;
+      append(frame.data(), frame.size());
+      _responses.pop_front();
+    }
+
+    double elapsed  = (now_ms - _start_ms) / 1000.0;
+    uint64_t states = static_cast<uint64_t>(elapsed * _config.state_hz);
+    for (; _state_due < states; _state_due++) {
+      emitState();
+    }
+    uint64_t clouds = static_cast<uint64_t>(elapsed * _config.cloud_hz);
+    bool cloud_on   = _user_log || !_config.require_user_log;
+    for (; _cloud_due < clouds; _cloud_due++) {
+      if (!cloud_on)
+        continue;
+      emitCloud(static_cast<uint16_t>(
+          TypeFallDetection::Report3DPointCloudDetection));
+      emitCloud(static_cast<uint16_t>(
+          TypeFallDetection::Report3DPointCloudTartgetInfo));
+    }
+  }
+
+  /**
+   * @brief Take up to `capacity` of the bytes the module sent.
+   */
+  size_t read(uint8_t* out, size_t capacity) {
+    size_t len = pending();
+    if (len > capacity)
+      len = capacity;
+    memcpy(out, _out.data() + _out_head, len);
+    _out_head += len;
+    if (_out_head == _out.size()) {
+      _out.clear();
+      _out_head = 0;
+    } else if (_out_head > 64 * 1024) {
+      _out.erase(_out.begin(), _out.begin() + _out_head);
+      _out_head = 0;
+    }
+    return len;
+  }
+
+  size_t pending() const {
+    return _out.size() - _out_head;
+  }
+
+  const mmWaveEmulatorStats& stats() const {
+    return _stats;
+  }
+  const FallRadarParameters& parameters() const {
+    return _parameters;
+  }
+};
+
+#endif /*MMWAVE_HOST_EMULATOR_H*/
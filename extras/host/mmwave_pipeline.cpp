@@ -0,0 +1,467 @@
+/**
+ * @file mmwave_pipeline.cpp
+ * @date  18 October 2026
+ *
+ * @note Gateway data path on a pipeline of threads: read, decode, filter,
+ * cluster and publish, each stage on its own thread.
+ *
+ * @copyright © 2024, Seeed Studio
+ *
+ * @attention The stages, see mmwave_pipeline.h for the queues:
+ *   read     the port or a capture, cut into valid frames by the library's
+ *            parser (the source)
+ *   decode   the library's MR60FDA2 or MR60BHA2 decoders; types they do
+ *            not handle are filtered out
+ *   filter   removes static clutter from point clouds (mmWaveClutterMap)
+ *   cluster  counts the clusters of point clouds
+ *   publish  one JSON line per message on the output
+ *   slow     sleeps -d ms per message, in place of heavy analytics
+ * The graph is a list of chains, "read>decode>filter>cluster>publish" by
+ * default; "read>decode>publish,decode>slow" also feeds a copy of every
+ * decoded message to slow. -q sets the queue of a stage, e.g.
+ * "-q slow=16:drop-oldest:2" for 16 messages, dropping the oldest, with
+ * two threads. By default decode takes 1024 messages and drops the newest,
+ * so the port is always read, slow takes 64 and drops the oldest, and the
+ * others take 256 and block. filter and publish keep state and run on one
+ * thread. The metrics of every stage are printed to stderr every -i
+ * seconds and at the end.
+ *   g++ -std=gnu++11 -O2 -pthread -Iarduino -I../../src mmwave_pipeline.cpp \
+ *       arduino/Arduino.cpp ../../src/S*.cpp -o mmwave_pipeline
+ *   ./mmwave_pipeline [-m fda2|bha2] [-b baud] [-g graph] [-q stage=queue]
+ *       [-d slow_ms] [-i seconds] [-o output] device|capture
+ */
+
+#include <errno.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdlib.h>
+
+#include <cstdio>
+#include <map>
+
+#include "Seeed_Arduino_mmWave.h"
+#include "SeeedmmWaveClutter.h"
+#include "host_serial.h"
+#include "mmwave_pipeline.h"
+
+static volatile sig_atomic_t stop = 0;
+
+static void onSignal(int) {
+  stop = 1;
+}
+
+/**
+ * @brief A sensor class that decodes one frame into a message, through
+ * processFrame() and the getters, as the sketches would.
+ */
+template <class Sensor>
+class FrameDecoder : public Sensor {
+ private:
+  void collect(mmWaveMessage& message);
+
+ public:
+  bool decode(mmWaveMessage& message) {
+    if (!this->processFrame(message.frame, message.length))
+      return false;
+    message.decoded = true;
+    collect(message);
+    return true;
+  }
+};
+
+template <>
+void FrameDecoder<SEEED_MR60FDA2>::collect(mmWaveMessage& message) {
+  switch (static_cast<TypeFallDetection>(message.type)) {
+    case TypeFallDetection::ReportFallDetection:
+      message.flag = getFall();
+      break;
+    case TypeFallDetection::ReportUnmannedDetection:
+      message.flag = getHuman();
+      break;
+    case TypeFallDetection::Report3DPointCloudDetection:
+      getPeopleCountingPointCloud(message.cloud);
+      break;
+    case TypeFallDetection::Report3DPointCloudTartgetInfo:
+      getPeopleCountingTartgetInfo(message.cloud);
+      break;
+    default:
+      break;
+  }
+}
+
+template <>
+void FrameDecoder<SEEED_MR60BHA2>::collect(mmWaveMessage& message) {
+  switch (static_cast<TypeHeartBreath>(message.type)) {
+    case TypeHeartBreath::TypeHeartRate:
+      getHeartRate(message.value);
+      break;
+    case TypeHeartBreath::TypeBreathRate:
+      getBreathRate(message.value);
+      break;
+    case TypeHeartBreath::TypeHeartBreathDistance:
+      getDistance(message.value);
+      break;
+    case TypeHeartBreath::ReportHumanDetection:
+      message.flag = isHumanDetected();
+      break;
+    case TypeHeartBreath::Report3DPointCloudDetection:
+      getPeopleCountingPointCloud(message.cloud);
+      break;
+    case TypeHeartBreath::Report3DPointCloudTartgetInfo:
+      getPeopleCountingTartgetInfo(message.cloud);
+      break;
+    default:
+      break;
+  }
+}
+
+/* One decoder per thread, so decode may run on several */
+template <class Sensor>
+static bool decodeFrame(mmWaveMessage& message) {
+  static thread_local FrameDecoder<Sensor> decoder;
+  return decoder.decode(message);
+}
+
+static bool isCloud(uint16_t type) {
+  return type == static_cast<uint16_t>(
+                     TypeFallDetection::Report3DPointCloudDetection) ||
+         type == static_cast<uint16_t>(
+                     TypeFallDetection::Report3DPointCloudTartgetInfo);
+}
+
+/* The source: frames from a port, reopened when it goes away, or from a
+ * capture read once */
+class FrameReader {
+ private:
+  const char* _device;
+  long _baud;
+  int _fd   = -1;
+  bool _tty = false;
+  mmWaveFrameParser _parser;
+  uint8_t _chunk[4096];
+
+ public:
+  std::atomic<uint64_t> checksum_errors{0};
+
+  FrameReader(const char* device, long baud) : _device(device), _baud(baud) {}
+  ~FrameReader() {
+    if (_fd >= 0)
+      close(_fd);
+  }
+
+  bool read(mmWaveEmitter& out) {
+    if (_fd < 0) {
+      _fd = mmWaveHostOpenSerial(_device, _baud, O_RDONLY);
+      if (_fd < 0) {
+        perror(_device);
+        sleep(1);
+        return !out.stopping();
+      }
+      _tty = isatty(_fd);
+      _parser.reset();
+    }
+    // Wake up now and then to notice stop()
+    struct pollfd ready = {_fd, POLLIN, 0};
+    if (poll(&ready, 1, 100) == 0)
+      return true;
+    ssize_t n = ::read(_fd, _chunk, sizeof(_chunk));
+    if (n <= 0) {
+      if (n < 0 && errno == EINTR)
+        return true;
+      close(_fd);
+      _fd = -1;
+      if (!_tty)
+        return false;  // end of a capture file or pipe
+      sleep(1);        // port gone, wait for it to come back
+      return true;
+    }
+    for (ssize_t i = 0; i < n; i++) {
+      if (!_parser.push(_chunk[i]))
+        continue;
+      if (!mmWaveValidateFrame(_parser.frame(), _parser.length())) {
+        checksum_errors++;
+        continue;
+      }
+      mmWaveMessage* message = out.acquire();
+      if (!message)
+        continue;
+      message->received_ns = mmWavePipelineNowNs();
+      message->type        = mmWaveFrameType(_parser.frame());
+      message->length      = _parser.length();
+      memcpy(message->frame, _parser.frame(), _parser.length());
+      out.emit(message);
+    }
+    return true;
+  }
+};
+
+/* Only point clouds are filtered, the other reports pass */
+class ClutterStage {
+ private:
+  mmWaveClutterMap _map;
+
+ public:
+  bool process(mmWaveMessage& message) {
+    if (message.type ==
+        static_cast<uint16_t>(TypeFallDetection::Report3DPointCloudDetection))
+      _map.filter(message.cloud);
+    return true;
+  }
+};
+
+static bool countClusters(mmWaveMessage& message) {
+  if (!isCloud(message.type))
+    return true;
+  int32_t seen[64];
+  size_t count = 0;
+  for (const TargetN& point : message.cloud.targets) {
+    size_t i = 0;
+    while (i < count && seen[i] != point.cluster_index) {
+      i++;
+    }
+    if (i == count && count < 64)
+      seen[count++] = point.cluster_index;
+  }
+  message.clusters = count;
+  return true;
+}
+
+class PublishStage {
+ private:
+  FILE* _out;
+  char _buffer[512];
+
+ public:
+  explicit PublishStage(FILE* out) : _out(out) {}
+
+  bool process(mmWaveMessage& message) {
+    mmWaveJsonWriter json(_buffer, sizeof(_buffer));
+    uint64_t latency_ns = mmWavePipelineNowNs() - message.received_ns;
+    json.beginObject()
+        .member("seq", static_cast<uint32_t>(message.sequence))
+        .member("type", static_cast<uint32_t>(message.type))
+        .member("latency_us", static_cast<uint32_t>(latency_ns / 1000));
+    if (isCloud(message.type))
+      json.member("points", static_cast<uint32_t>(message.cloud.targets.size()))
+          .member("clusters", message.clusters);
+    else if (message.value != 0)
+      json.member("value", message.value, 2);
+    else
+      json.key("flag").value(message.flag);
+    json.endObject().newline();
+    if (!json.overflow())
+      fwrite(json.data(), 1, json.size(), _out);
+    return true;
+  }
+};
+
+/* Queue of a stage, set with -q */
+struct QueueConfig {
+  size_t capacity;
+  mmWaveFullPolicy policy;
+  unsigned threads;
+};
+
+static bool parseQueue(const char* text,
+                       std::map<std::string, QueueConfig>& queues) {
+  const char* equals = strchr(text, '=');
+  if (!equals)
+    return false;
+  std::string name(text, equals - text);
+  auto found = queues.find(name);
+  if (found == queues.end())
+    return false;
+  QueueConfig& config = found->second;
+  char* end;
+  config.capacity = strtoul(equals + 1, &end, 0);
+  if (*end == ':') {
+    const char* policy = end + 1;
+    size_t length      = strcspn(policy, ":");
+    if (strncmp(policy, "block", length) == 0)
+      config.policy = mmWaveFullPolicy::Block;
+    else if (strncmp(policy, "drop-newest", length) == 0)
+      config.policy = mmWaveFullPolicy::DropNewest;
+    else if (strncmp(policy, "drop-oldest", length) == 0)
+      config.policy = mmWaveFullPolicy::DropOldest;
+    else
+      return false;
+    end = const_cast<char*>(policy + length);
+    if (*end == ':')
+      config.threads = strtoul(end + 1, &end, 0);
+  }
+  return *end == '\0' && config.capacity > 0 && config.threads > 0;
+}
+
+static void printMetrics(const mmWavePipeline& pipeline, uint64_t errors) {
+  std::vector<mmWaveStageMetrics> metrics;
+  pipeline.metrics(metrics);
+  fprintf(stderr, "%-8s %3s %10s %10s %9s %9s %11s %6s %10s\n", "stage",
+          "thr", "in", "out", "filtered", "dropped", "depth", "util",
+          "blocked_ms");
+  for (const mmWaveStageMetrics& m : metrics) {
+    char depth[32];
+    snprintf(depth, sizeof(depth), "%zu/%zu/%zu", m.depth, m.max_depth,
+             m.capacity);
+    fprintf(stderr, "%-8s %3u %10llu %10llu %9llu %9llu %11s %5.1f%% %10.1f\n",
+            m.name.c_str(), m.threads, static_cast<unsigned long long>(m.in),
+            static_cast<unsigned long long>(m.out),
+            static_cast<unsigned long long>(m.filtered),
+            static_cast<unsigned long long>(m.dropped), depth,
+            100 * m.utilisation, m.blocked_ns / 1e6);
+  }
+  fprintf(stderr, "checksum errors %llu\n",
+          static_cast<unsigned long long>(errors));
+}
+
+static void usage(const char* self) {
+  fprintf(stderr,
+          "usage: %s [-m fda2|bha2] [-b baud] [-g graph] [-q stage=queue] "
+          "[-d slow_ms] [-i seconds] [-o output] device|capture\n"
+          "  graph: chains of read, decode, filter, cluster, publish, slow\n"
+          "  queue: capacity[:block|drop-newest|drop-oldest[:threads]]\n",
+          self);
+}
+
+int main(int argc, char** argv) {
+  bool breath        = false;
+  long baud          = 115200;
+  std::string graph  = "read>decode>filter>cluster>publish";
+  uint32_t slow_ms   = 50;
+  double interval    = 5;
+  const char* output = nullptr;
+  std::map<std::string, QueueConfig> queues = {
+      {"decode", {1024, mmWaveFullPolicy::DropNewest, 1}},
+      {"filter", {256, mmWaveFullPolicy::Block, 1}},
+      {"cluster", {256, mmWaveFullPolicy::Block, 1}},
+      {"publish", {256, mmWaveFullPolicy::Block, 1}},
+      {"slow", {64, mmWaveFullPolicy::DropOldest, 1}},
+  };
+  int opt;
+  while ((opt = getopt(argc, argv, "m:b:g:q:d:i:o:")) != -1) {
+    switch (opt) {
+      case 'm':
+        breath = strcmp(optarg, "bha2") == 0;
+        break;
+      case 'b':
+        baud = atol(optarg);
+        break;
+      case 'g':
+        graph = optarg;
+        break;
+      case 'q':
+        if (!parseQueue(optarg, queues)) {
+          fprintf(stderr, "bad queue %s\n", optarg);
+          return 2;
+        }
+        break;
+      case 'd':
+        slow_ms = atoi(optarg);
+        break;
+      case 'i':
+        interval = atof(optarg);
+        break;
+      case 'o':
+        output = optarg;
+        break;
+      default:
+        usage(argv[0]);
+        return 2;
+    }
+  }
+  if (optind >= argc) {
+    usage(argv[0]);
+    return 2;
+  }
+  if (queues["filter"].threads > 1 || queues["publish"].threads > 1) {
+    fprintf(stderr, "filter and publish run on one thread\n");
+    return 2;
+  }
+  FILE* out = output ? fopen(output, "w") : stdout;
+  if (!out) {
+    perror(output);
+    return 1;
+  }
+
+  FrameReader reader(argv[optind], baud);
+  ClutterStage clutter;
+  PublishStage publish(out);
+
+  // Stages are created as the graph names them
+  mmWavePipeline pipeline;
+  auto stage = [&](const std::string& name) -> int {
+    int index = pipeline.find(name);
+    if (index >= 0)
+      return index;
+    if (name == "read")
+      return pipeline.addSource(
+          name, [&](mmWaveEmitter& emitter) { return reader.read(emitter); });
+    auto config = queues.find(name);
+    if (config == queues.end())
+      return -1;
+    mmWavePipeline::Process process;
+    if (name == "decode")
+      process = breath ? decodeFrame<SEEED_MR60BHA2>
+                       : decodeFrame<SEEED_MR60FDA2>;
+    else if (name == "filter")
+      process = [&](mmWaveMessage& m) { return clutter.process(m); };
+    else if (name == "cluster")
+      process = countClusters;
+    else if (name == "publish")
+      process = [&](mmWaveMessage& m) { return publish.process(m); };
+    else
+      process = [=](mmWaveMessage&) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(slow_ms));
+        return true;
+      };
+    const QueueConfig& queue = config->second;
+    return pipeline.addStage(name, process, queue.capacity, queue.policy,
+                             queue.threads);
+  };
+  size_t begin = 0;
+  while (begin <= graph.size()) {
+    size_t end = graph.find(',', begin);
+    if (end == std::string::npos)
+      end = graph.size();
+    int from = -1;
+    for (size_t at = begin; at <= end;) {
+      size_t next = graph.find('>', at);
+      if (next == std::string::npos || next > end)
+        next = end;
+      std::string name = graph.substr(at, next - at);
+      int to           = stage(name);
+      if (to < 0 || (from >= 0 && !pipeline.connect(from, to))) {
+        fprintf(stderr, "bad graph at %s\n", name.c_str());
+        return 2;
+      }
+      from = to;
+      at   = next + 1;
+    }
+    begin = end + 1;
+  }
+
+  struct sigaction action;
+  memset(&action, 0, sizeof(action));
+  action.sa_handler = onSignal;
+  sigaction(SIGINT, &action, nullptr);
+  sigaction(SIGTERM, &action, nullptr);
+
+  if (!pipeline.start()) {
+    fprintf(stderr, "the graph needs read\n");
+    return 2;
+  }
+  uint64_t next_report = mmWavePipelineNowNs() + interval * 1e9;
+  while (!pipeline.finished()) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    if (stop)
+      pipeline.stop();
+    if (interval > 0 && mmWavePipelineNowNs() >= next_report) {
+      printMetrics(pipeline, reader.checksum_errors);
+      next_report += interval * 1e9;
+    }
+  }
+  pipeline.join();
+  printMetrics(pipeline, reader.checksum_errors);
+  if (out != stdout)
+    fclose(out);
+  return 0;
+}
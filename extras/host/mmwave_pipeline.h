@@ -0,0 +1,623 @@
+/**
+ * @file mmwave_pipeline.h
+ * @date  18 October 2026
+ *
+ * @note Multi-stage processing of radar frames on a host, one thread per
+ * stage, connected by bounded lock-free queues.
+ *
+ * @copyright © 2024, Seeed Studio
+ *
+ * @attention A pipeline is a graph of stages without cycles. A source stage
+ * produces messages, typically frames read from the port. Every other stage
+ * has one input queue, which any number of stages may feed, and runs
+ * `threads` threads that take messages from it. A stage with several
+ * outputs hands the message to the first and a copy to each other one.
+ *
+ * Messages come from a pool allocated by start(), large enough for every
+ * queue to be full, so nothing is allocated while frames flow. Each
+ * message is owned by one queue or one thread at a time.
+ *
+ * The queues are bounded multi-producer multi-consumer rings (D. Vyukov's
+ * design: one sequence number per cell, no locks). What happens when a
+ * queue is full is the policy of the stage it feeds:
+ * - Block: the producer waits, so a slow stage slows those before it.
+ * - DropNewest: the message being pushed is dropped.
+ * - DropOldest: the oldest queued message is dropped to make room.
+ * Put a dropping queue between the source and anything that may be slow,
+ * so the port is always read. Drops are counted per stage.
+ *
+ * Idle threads poll with an exponential backoff up to
+ * MMWAVE_PIPELINE_IDLE_US. Per stage the pipeline counts messages in, out,
+ * filtered and dropped, the time spent blocked on full queues, the busy time
+ * of its threads, and the current and highest depth of its queue.
+ */
+
+#ifndef MMWAVE_PIPELINE_H
+#define MMWAVE_PIPELINE_H
+
+#include <stdint.h>
+#include <string.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "SEEED_Public.h"
+#include "SeeedmmWaveFrame.h"
+#include "SeeedmmWaveSchema.h"
+
+/* Longest sleep of an idle or blocked thread */
+#ifndef MMWAVE_PIPELINE_IDLE_US
+#  define MMWAVE_PIPELINE_IDLE_US 200
+#endif
+
+static inline uint64_t mmWavePipelineNowNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+/**
+ * @brief Bounded MPMC queue. The capacity is rounded up to a power of two.
+ * Every cell carries a sequence number telling whose turn it is: a producer
+ * claims the cell at the enqueue position when its sequence equals that
+ * position, a consumer when it equals the position plus one.
+ */
+template <class T>
+class mmWaveMpmcQueue {
+ private:
+  struct Cell {
+    std::atomic<size_t> sequence;
+    T data;
+  };
+
+  std::unique_ptr<Cell[]> _cells;
+  size_t _mask;
+  // Producers and consumers on separate cache lines
+  char _padding[64];
+  std::atomic<size_t> _enqueue{0};
+  char _padding_enqueue[64 - sizeof(std::atomic<size_t>)];
+  std::atomic<size_t> _dequeue{0};
+
+ public:
+  explicit mmWaveMpmcQueue(size_t capacity) {
+    size_t size = 2;
+    while (size < capacity) {
+      size <<= 1;
+    }
+    _cells.reset(new Cell[size]);
+    _mask = size - 1;
+    for (size_t i = 0; i < size; i++) {
+      _cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  bool tryPush(const T& value) {
+    size_t position = _enqueue.load(std::memory_order_relaxed);
+    for (;;) {
+      Cell& cell      = _cells[position & _mask];
+      size_t sequence = cell.sequence.load(std::memory_order_acquire);
+      intptr_t turn   = static_cast<intptr_t>(sequence - position);
+      if (turn == 0) {
+        if (_enqueue.compare_exchange_weak(position, position + 1,
+                                           std::memory_order_relaxed)) {
+          cell.data = value;
+          cell.sequence.store(position + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (turn < 0) {
+        return false;  // full
+      } else {
+        position = _enqueue.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  bool tryPop(T& value) {
+    size_t position = _dequeue.load(std::memory_order_relaxed);
+    for (;;) {
+      Cell& cell      = _cells[position & _mask];
+      size_t sequence = cell.sequence.load(std::memory_order_acquire);
+      intptr_t turn   = static_cast<intptr_t>(sequence - (position + 1));
+      if (turn == 0) {
+        if (_dequeue.compare_exchange_weak(position, position + 1,
+                                           std::memory_order_relaxed)) {
+          value = cell.data;
+          cell.sequence.store(position + _mask + 1,
+                              std::memory_order_release);
+          return true;
+        }
+      } else if (turn < 0) {
+        return false;  // empty
+      } else {
+        position = _dequeue.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /* Approximate while other threads push or pop */
+  size_t size() const {
+    size_t enqueue = _enqueue.load(std::memory_order_relaxed);
+    size_t dequeue = _dequeue.load(std::memory_order_relaxed);
+    return enqueue > dequeue ? enqueue - dequeue : 0;
+  }
+  size_t capacity() const {
+    return _mask + 1;
+  }
+};
+
+/* A frame and what the stages learned from it */
+struct mmWaveMessage {
+  uint64_t sequence;     // order in which the source produced it
+  uint64_t received_ns;  // mmWavePipelineNowNs() when the frame was complete
+  uint16_t type;
+  uint16_t length;
+  uint8_t frame[MMWAVE_MAX_FRAME_SIZE];
+
+  // Set by a decoding stage
+  bool decoded;
+  bool flag;             // fall or presence reports
+  float value;           // rates and distance
+  PeopleCounting cloud;  // point clouds and target info
+  uint32_t clusters;     // set by a clustering stage
+
+  mmWaveMessage() {
+    mmWaveReserveCloud(cloud);
+    clear();
+  }
+  void clear() {
+    sequence    = 0;
+    received_ns = 0;
+    type        = 0;
+    length      = 0;
+    decoded     = false;
+    flag        = false;
+    value       = 0;
+    clusters    = 0;
+    cloud.targets.clear();
+  }
+  /* Keeps the capacity of the cloud */
+  void copyFrom(const mmWaveMessage& other) {
+    sequence    = other.sequence;
+    received_ns = other.received_ns;
+    type        = other.type;
+    length      = other.length;
+    memcpy(frame, other.frame, other.length);
+    decoded  = other.decoded;
+    flag     = other.flag;
+    value    = other.value;
+    clusters = other.clusters;
+    cloud.targets.assign(other.cloud.targets.begin(),
+                         other.cloud.targets.end());
+  }
+};
+
+enum class mmWaveFullPolicy : uint8_t {
+  Block,       // the producer waits for room
+  DropNewest,  // the message pushed is dropped
+  DropOldest,  // the oldest queued message is dropped
+};
+
+/* Counters of a stage, see mmWavePipeline::metrics() */
+typedef struct mmWaveStageMetrics {
+  std::string name;
+  unsigned threads;
+  uint64_t in;          // taken from its queue, or produced by a source
+  uint64_t out;         // passed on by process()
+  uint64_t filtered;    // refused by process()
+  uint64_t dropped;     // dropped by the policy of its queue, or no message
+  uint64_t blocked_ns;  // waiting for room in the queues it feeds
+  uint64_t busy_ns;     // in process() and handing messages on, unblocked
+  size_t depth;         // of its queue, now
+  size_t max_depth;
+  size_t capacity;
+  double utilisation;  // busy time over the time running, per thread
+} mmWaveStageMetrics;
+
+/* Sleeps a little longer each time nothing could be done */
+class mmWaveBackoff {
+ private:
+  uint32_t _step = 0;
+
+ public:
+  void reset() {
+    _step = 0;
+  }
+  void wait() {
+    if (_step < 16) {
+      std::this_thread::yield();
+    } else {
+      uint32_t us = 1u << (_step - 16 < 8 ? _step - 16 : 8);
+      std::this_thread::sleep_for(std::chrono::microseconds(
+          us < MMWAVE_PIPELINE_IDLE_US ? us : MMWAVE_PIPELINE_IDLE_US));
+    }
+    if (_step < 32)
+      _step++;
+  }
+};
+
+class mmWavePipeline;
+
+/* Given to a source to produce messages */
+class mmWaveEmitter {
+ private:
+  mmWavePipeline& _pipeline;
+  size_t _stage;
+
+ public:
+  mmWaveEmitter(mmWavePipeline& pipeline, size_t stage)
+      : _pipeline(pipeline), _stage(stage) {}
+
+  /* A cleared message, nullptr if the pool is empty (counted as a drop) */
+  mmWaveMessage* acquire();
+  /* Hand the message on, it belongs to the pipeline again */
+  void emit(mmWaveMessage* message);
+  /* The pipeline is stopping, the source should return false */
+  bool stopping() const;
+};
+
+class mmWavePipeline {
+ public:
+  /* Called in a loop by the source thread until it returns false */
+  typedef std::function<bool(mmWaveEmitter& out)> Source;
+  /* Returns false to drop the message rather than pass it on */
+  typedef std::function<bool(mmWaveMessage& message)> Process;
+
+ private:
+  struct Stage {
+    std::string name;
+    Source source;
+    Process process;
+    unsigned threads = 1;
+    mmWaveFullPolicy policy = mmWaveFullPolicy::Block;
+    std::unique_ptr<mmWaveMpmcQueue<mmWaveMessage*> > queue;
+    std::vector<size_t> outputs;
+    std::atomic<int> producers{0};  // stages still feeding the queue
+    std::atomic<int> running{0};    // threads of its own
+
+    std::atomic<uint64_t> in{0};
+    std::atomic<uint64_t> out{0};
+    std::atomic<uint64_t> filtered{0};
+    std::atomic<uint64_t> dropped{0};
+    std::atomic<uint64_t> blocked_ns{0};
+    std::atomic<uint64_t> busy_ns{0};
+    std::atomic<size_t> max_depth{0};
+  };
+
+  std::vector<std::unique_ptr<Stage> > _stages;
+  std::vector<mmWaveMessage> _messages;
+  std::unique_ptr<mmWaveMpmcQueue<mmWaveMessage*> > _free;
+  std::vector<std::thread> _threads;
+  std::atomic<bool> _stopping{false};
+  std::atomic<uint64_t> _sequence{0};
+  uint64_t _start_ns = 0;
+  uint64_t _end_ns   = 0;
+
+  friend class mmWaveEmitter;
+
+  bool reaches(size_t from, size_t to) const {
+    if (from == to)
+      return true;
+    for (size_t next : _stages[from]->outputs) {
+      if (reaches(next, to))
+        return true;
+    }
+    return false;
+  }
+
+  mmWaveMessage* acquire(Stage& stage) {
+    mmWaveMessage* message;
+    if (!_free->tryPop(message)) {
+      stage.dropped.fetch_add(1, std::memory_order_relaxed);
+      return nullptr;
+    }
+    message->clear();
+    return message;
+  }
+  void release(mmWaveMessage* message) {
+    _free->tryPush(message);  // never full, it holds every message
+  }
+
+  /* Push into the queue of `to` by its policy, blocked time goes to `from` */
+  void push(Stage& from, Stage& to, mmWaveMessage* message) {
+    mmWaveMpmcQueue<mmWaveMessage*>& queue = *to.queue;
+    if (!queue.tryPush(message)) {
+      if (to.policy == mmWaveFullPolicy::DropNewest) {
+        to.dropped.fetch_add(1, std::memory_order_relaxed);
+        release(message);
+        return;
+      }
+      uint64_t since = mmWavePipelineNowNs();
+      mmWaveBackoff backoff;
+      while (!queue.tryPush(message)) {
+        mmWaveMessage* oldest;
+        if (to.policy == mmWaveFullPolicy::DropOldest) {
+          if (queue.tryPop(oldest)) {
+            to.dropped.fetch_add(1, std::memory_order_relaxed);
+            release(oldest);
+          }
+        } else {
+          backoff.wait();
+        }
+      }
+      if (to.policy == mmWaveFullPolicy::Block)
+        from.blocked_ns.fetch_add(mmWavePipelineNowNs() - since,
+                                  std::memory_order_relaxed);
+    }
+    size_t depth = queue.size();
+    size_t max   = to.max_depth.load(std::memory_order_relaxed);
+    while (depth > max &&
+           !to.max_depth.compare_exchange_weak(max, depth,
+                                               std::memory_order_relaxed)) {
+    }
+  }
+
+  /* The first output takes the message, the others a copy */
+  void emit(Stage& stage, mmWaveMessage* message) {
+    if (stage.outputs.empty()) {
+      release(message);
+      return;
+    }
+    for (size_t i = 1; i < stage.outputs.size(); i++) {
+      Stage& to           = *_stages[stage.outputs[i]];
+      mmWaveMessage* copy = acquire(to);
+      if (!copy)
+        continue;
+      copy->copyFrom(*message);
+      push(stage, to, copy);
+    }
+    push(stage, *_stages[stage.outputs[0]], message);
+  }
+
+  /* Last thread of a stage out: its outputs lose a producer */
+  void finish(Stage& stage) {
+    for (size_t output : stage.outputs) {
+      _stages[output]->producers.fetch_sub(1, std::memory_order_release);
+    }
+  }
+
+  void runSource(size_t index) {
+    Stage& stage = *_stages[index];
+    mmWaveEmitter emitter(*this, index);
+    while (!_stopping.load(std::memory_order_relaxed) &&
+           stage.source(emitter)) {
+    }
+    finish(stage);
+    stage.running.store(0, std::memory_order_release);
+  }
+
+  void runStage(size_t index) {
+    Stage& stage = *_stages[index];
+    mmWaveBackoff backoff;
+    for (;;) {
+      mmWaveMessage* message;
+      if (!stage.queue->tryPop(message)) {
+        if (stage.producers.load(std::memory_order_acquire) > 0) {
+          backoff.wait();
+          continue;
+        }
+        // Producers finish after their last push, look once more
+        if (!stage.queue->tryPop(message))
+          break;
+      }
+      backoff.reset();
+      uint64_t begin = mmWavePipelineNowNs();
+      stage.in.fetch_add(1, std::memory_order_relaxed);
+      if (stage.process(*message)) {
+        stage.out.fetch_add(1, std::memory_order_relaxed);
+        emit(stage, message);
+      } else {
+        stage.filtered.fetch_add(1, std::memory_order_relaxed);
+        release(message);
+      }
+      stage.busy_ns.fetch_add(mmWavePipelineNowNs() - begin,
+                              std::memory_order_relaxed);
+    }
+    if (stage.running.fetch_sub(1, std::memory_order_acq_rel) == 1)
+      finish(stage);
+  }
+
+ public:
+  mmWavePipeline() {}
+  ~mmWavePipeline() {
+    stop();
+    join();
+  }
+
+  /**
+   * @brief Add a stage producing messages.
+   *
+   * @return Its index, for connect().
+   */
+  size_t addSource(const std::string& name, Source source) {
+    std::unique_ptr<Stage> stage(new Stage());
+    stage->name   = name;
+    stage->source = source;
+    _stages.push_back(std::move(stage));
+    return _stages.size() - 1;
+  }
+
+  /**
+   * @brief Add a stage processing messages.
+   *
+   * @param capacity Of its input queue, rounded up to a power of two.
+   * @param policy When its queue is full.
+   * @param threads Running process(), which must then be thread safe. With
+   * more than one the messages may leave out of order.
+   * @return Its index, for connect().
+   */
+  size_t addStage(const std::string& name, Process process, size_t capacity,
+                  mmWaveFullPolicy policy, unsigned threads = 1) {
+    std::unique_ptr<Stage> stage(new Stage());
+    stage->name    = name;
+    stage->process = process;
+    stage->policy  = policy;
+    stage->threads = threads ? threads : 1;
+    stage->queue.reset(new mmWaveMpmcQueue<mmWaveMessage*>(capacity));
+    _stages.push_back(std::move(stage));
+    return _stages.size() - 1;
+  }
+
+  /* The stage named so, or -1 */
+  int find(const std::string& name) const {
+    for (size_t i = 0; i < _stages.size(); i++) {
+      if (_stages[i]->name == name)
+        return static_cast<int>(i);
+    }
+    return -1;
+  }
+
+  /**
+   * @brief Send the messages of `from` to `to`.
+   *
+   * @retval false `to` is a source, the edge exists or would close a cycle,
+   * or the pipeline is running.
+   */
+  bool connect(size_t from, size_t to) {
+    if (!_threads.empty() || from >= _stages.size() ||
+        to >= _stages.size() || !_stages[to]->queue || reaches(to, from))
+      return false;
+    for (size_t output : _stages[from]->outputs) {
+      if (output == to)
+        return false;
+    }
+    _stages[from]->outputs.push_back(to);
+    return true;
+  }
+
+  /**
+   * @brief Allocate the messages and start every thread.
+   *
+   * @retval false Already started, or there is no source.
+   */
+  bool start() {
+    if (!_threads.empty())
+      return false;
+    size_t messages = 0;
+    bool sources    = false;
+    for (const auto& stage : _stages) {
+      // The queue full, and per thread the message in hand, its copies
+      // and one taken out by DropOldest
+      size_t held = 2 + stage->outputs.size();
+      if (stage->queue) {
+        messages += stage->queue->capacity() + stage->threads * held;
+      } else {
+        sources = true;
+        messages += held;
+      }
+    }
+    if (!sources)
+      return false;
+    _messages = std::vector<mmWaveMessage>(messages);
+    _free.reset(new mmWaveMpmcQueue<mmWaveMessage*>(messages));
+    for (mmWaveMessage& message : _messages) {
+      _free->tryPush(&message);
+    }
+
+    // A stage ends when no stage feeds it and its queue is empty
+    for (const auto& stage : _stages) {
+      for (size_t output : stage->outputs) {
+        _stages[output]->producers.fetch_add(1, std::memory_order_relaxed);
+      }
+    }
+    for (const auto& stage : _stages) {
+      stage->running.store(stage->queue ? stage->threads : 1);
+    }
+    _stopping.store(false);
+    _start_ns = mmWavePipelineNowNs();
+    _end_ns   = 0;
+    for (size_t i = 0; i < _stages.size(); i++) {
+      if (!_stages[i]->queue) {
+        _threads.emplace_back(&mmWavePipeline::runSource, this, i);
+        continue;
+      }
+      for (unsigned t = 0; t < _stages[i]->threads; t++) {
+        _threads.emplace_back(&mmWavePipeline::runStage, this, i);
+      }
+    }
+    return true;
+  }
+
+  /* Ask the sources to end; the other stages drain their queues */
+  void stop() {
+    _stopping.store(true);
+  }
+  bool stopping() const {
+    return _stopping.load(std::memory_order_relaxed);
+  }
+
+  /* Every thread has ended, join() will not wait */
+  bool finished() const {
+    for (const auto& stage : _stages) {
+      if (stage->running.load(std::memory_order_acquire) > 0)
+        return false;
+    }
+    return true;
+  }
+
+  /* Wait for every thread, after the sources ended */
+  void join() {
+    for (std::thread& thread : _threads) {
+      thread.join();
+    }
+    if (!_threads.empty())
+      _end_ns = mmWavePipelineNowNs();
+    _threads.clear();
+  }
+
+  uint64_t nextSequence() {
+    return _sequence.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /* Counters of every stage, in the order they were added */
+  void metrics(std::vector<mmWaveStageMetrics>& out) const {
+    uint64_t end   = _end_ns ? _end_ns : mmWavePipelineNowNs();
+    double elapsed = _start_ns ? static_cast<double>(end - _start_ns) : 0;
+    out.resize(_stages.size());
+    for (size_t i = 0; i < _stages.size(); i++) {
+      const Stage& stage    = *_stages[i];
+      mmWaveStageMetrics& m = out[i];
+
+      m.name        = stage.name;
+      m.threads     = stage.queue ? stage.threads : 1;
+      m.in          = stage.in.load(std::memory_order_relaxed);
+      m.out         = stage.out.load(std::memory_order_relaxed);
+      m.filtered    = stage.filtered.load(std::memory_order_relaxed);
+      m.dropped     = stage.dropped.load(std::memory_order_relaxed);
+      m.blocked_ns  = stage.blocked_ns.load(std::memory_order_relaxed);
+      m.busy_ns     = stage.busy_ns.load(std::memory_order_relaxed);
+      m.busy_ns     = m.busy_ns > m.blocked_ns ? m.busy_ns - m.blocked_ns : 0;
+      m.depth       = stage.queue ? stage.queue->size() : 0;
+      m.max_depth   = stage.max_depth.load(std::memory_order_relaxed);
+      m.capacity    = stage.queue ? stage.queue->capacity() : 0;
+      m.utilisation = elapsed > 0 ? m.busy_ns / (elapsed * m.threads) : 0;
+    }
+  }
+};
+
+inline mmWaveMessage* mmWaveEmitter::acquire() {
+  mmWaveMessage* message = _pipeline.acquire(*_pipeline._stages[_stage]);
+  if (message)
+    message->sequence = _pipeline.nextSequence();
+  return message;
+}
+
+inline void mmWaveEmitter::emit(mmWaveMessage* message) {
+  mmWavePipeline::Stage& stage = *_pipeline._stages[_stage];
+  uint64_t begin               = mmWavePipelineNowNs();
+  stage.in.fetch_add(1, std::memory_order_relaxed);
+  stage.out.fetch_add(1, std::memory_order_relaxed);
+  _pipeline.emit(stage, message);
+  stage.busy_ns.fetch_add(mmWavePipelineNowNs() - begin,
+                          std::memory_order_relaxed);
+}
+
+inline bool mmWaveEmitter::stopping() const {
+  return _pipeline.stopping();
+}
+
+#endif /*MMWAVE_PIPELINE_H*/
@@ -0,0 +1,291 @@
+/**
+ * @file mmwave_shm.h
+ * @date  18 October 2026
+ *
+ * @note Shared-memory ring of radar frames, written by mmwave_shmd and read
+ * by any number of local consumers.
+ *
+ * @copyright © 2024, Seeed Studio
+ *
+ * @attention The segment is a mmWaveShmHeader followed by `slot_count`
+ * mmWaveShmRecord slots. There is one writer; readers map the segment read
+ * only and keep their own cursor, so they never slow down the writer or
+ * each other. Record n lives in slot n % slot_count and is guarded by a
+ * per-slot sequence word, a seqlock: the writer stores 2n + 1 before it
+ * fills the slot and 2n + 2 afterwards. A reader that sees 2n + 2 before
+ * and after reading has a consistent record; a larger value means the
+ * writer has lapped it and the reader skips ahead, counting the records it
+ * lost. All fields are little-endian, see mmwave_shm.py for a Python
+ * reader of the same layout.
+ */
+
+#ifndef MMWAVE_HOST_SHM_H
+#define MMWAVE_HOST_SHM_H
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cstring>
+
+#include "SeeedmmWaveFrame.h"
+
+#if ATOMIC_LLONG_LOCK_FREE != 2
+#  error "the shared-memory ring needs lock-free 64-bit atomics"
+#endif
+
+#define MMWAVE_SHM_NAME    "/mmwave"
+#define MMWAVE_SHM_MAGIC   0x56574D4DUL  // "MMWV"
+#define MMWAVE_SHM_VERSION 1
+
+/* Records kept, a power of two */
+#ifndef MMWAVE_SHM_SLOTS
+#  define MMWAVE_SHM_SLOTS 256
+#endif
+
+struct alignas(64) mmWaveShmHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t header_size;
+  uint32_t record_size;
+  uint32_t slot_count;
+  std::atomic<uint64_t> published;  // records written so far
+  uint64_t parser_dropped;          // frames the parser discarded
+  uint64_t checksum_errors;         // frames with a bad data checksum
+  int32_t writer_pid;
+};
+
+struct alignas(64) mmWaveShmRecord {
+  std::atomic<uint64_t> sequence;  // seqlock, 2n + 2 once record n is valid
+  uint64_t timestamp_ns;           // CLOCK_MONOTONIC at reception
+  uint16_t type;                   // frame type
+  uint16_t id;                     // frame id
+  uint16_t length;                 // bytes used in data
+  uint16_t reserved;
+  uint8_t data[MMWAVE_MAX_FRAME_DATA];  // frame payload, see SeeedmmWaveSchema
+};
+
+inline uint64_t mmWaveShmNow() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<uint64_t>(ts.tv_sec) * 1000000000ULL + ts.tv_nsec;
+}
+
+inline size_t mmWaveShmSize(uint32_t slots) {
+  return sizeof(mmWaveShmHeader) + slots * sizeof(mmWaveShmRecord);
+}
+
+/**
+ * @brief The single writer, owns the segment.
+ */
+class mmWaveShmWriter {
+ private:
+  mmWaveShmHeader* _header  = nullptr;
+  mmWaveShmRecord* _records = nullptr;
+  const char* _name         = nullptr;
+  uint64_t _next            = 0;
+
+ public:
+  ~mmWaveShmWriter() {
+    close();
+  }
+
+  bool create(const char* name = MMWAVE_SHM_NAME) {
+    int fd = shm_open(name, O_CREAT | O_RDWR | O_TRUNC, 0644);
+    if (fd < 0)
+      return false;
+    size_t size = mmWaveShmSize(MMWAVE_SHM_SLOTS);
+    void* map   = MAP_FAILED;
+    if (ftruncate(fd, size) == 0)
+      map = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (map == MAP_FAILED) {
+      shm_unlink(name);
+      return false;
+    }
+
+    // ftruncate() zeroed the segment, so every slot reads as not written
+    _name                 = name;
+    _header               = static_cast<mmWaveShmHeader*>(map);
+    _records              = reinterpret_cast<mmWaveShmRecord*>(_header + 1);
+    _header->version      = MMWAVE_SHM_VERSION;
+    _header->header_size  = sizeof(mmWaveShmHeader);
+    _header->record_size  = sizeof(mmWaveShmRecord);
+    _header->slot_count   = MMWAVE_SHM_SLOTS;
+    _header->writer_pid   = getpid();
+    std::atomic_thread_fence(std::memory_order_release);
+    _header->magic = MMWAVE_SHM_MAGIC;
+    return true;
+  }
+
+  void close() {
+    if (!_header)
+      return;
+    munmap(_header, mmWaveShmSize(MMWAVE_SHM_SLOTS));
+    shm_unlink(_name);
+    _header = nullptr;
+  }
+
+  /**
+   * @brief Publish a validated frame.
+   */
+  void publish(const uint8_t* frame) {
+    uint64_t n             = _next++;
+    mmWaveShmRecord& slot  = _records[n & (MMWAVE_SHM_SLOTS - 1)];
+    uint16_t length        = mmWaveFrameDataLength(frame);
+
+    slot.sequence.store(2 * n + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.timestamp_ns = mmWaveShmNow();
+    slot.type         = mmWaveFrameType(frame);
+    slot.id           = mmWaveFrameId(frame);
+    slot.length       = length;
+    memcpy(slot.data, frame + SIZE_FRAME_HEADER, length);
+    slot.sequence.store(2 * n + 2, std::memory_order_release);
+    _header->published.store(n + 1, std::memory_order_release);
+  }
+
+  void setErrors(uint64_t parser_dropped, uint64_t checksum_errors) {
+    _header->parser_dropped  = parser_dropped;
+    _header->checksum_errors = checksum_errors;
+  }
+};
+
+/**
+ * @brief A consumer with its own cursor.
+ *
+ * @code
+ * mmWaveShmReader reader;
+ * reader.attach();
+ * for (;;) {
+ *   const mmWaveShmRecord* record = reader.next();
+ *   if (!record) { usleep(1000); continue; }
+ *   use(record->type, record->data, record->length);
+ *   if (!reader.stillValid()) discard();  // overwritten while in use
+ * }
+ * @endcode
+ */
+class mmWaveShmReader {
+ private:
+  const mmWaveShmHeader* _header  = nullptr;
+  const mmWaveShmRecord* _records = nullptr;
+  const mmWaveShmRecord* _current = nullptr;
+  size_t _size                    = 0;
+  uint32_t _mask                  = 0;
+  uint64_t _cursor                = 0;
+  uint64_t _lost                  = 0;
+
+ public:
+  ~mmWaveShmReader() {
+    detach();
+  }
+
+  /**
+   * @brief Map the segment. Reading starts with the next record published.
+   *
+   * @retval false The daemon is not running or the layout differs.
+   */
+  bool attach(const char* name = MMWAVE_SHM_NAME) {
+    int fd = shm_open(name, O_RDONLY, 0);
+    if (fd < 0)
+      return false;
+    struct stat st;
+    void* map = MAP_FAILED;
+    if (fstat(fd, &st) == 0 &&
+        static_cast<size_t>(st.st_size) >= sizeof(mmWaveShmHeader))
+      map = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (map == MAP_FAILED)
+      return false;
+
+    _header = static_cast<const mmWaveShmHeader*>(map);
+    _size   = st.st_size;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (_header->magic != MMWAVE_SHM_MAGIC ||
+        _header->version != MMWAVE_SHM_VERSION ||
+        _header->record_size != sizeof(mmWaveShmRecord) ||
+        _size < mmWaveShmSize(_header->slot_count)) {
+      detach();
+      return false;
+    }
+    _records = reinterpret_cast<const mmWaveShmRecord*>(_header + 1);
+    _mask    = _header->slot_count - 1;
+    _cursor  = _header->published.load(std::memory_order_acquire);
+    return true;
+  }
+
+  void detach() {
+    if (_header)
+      munmap(const_cast<mmWaveShmHeader*>(_header), _size);
+    _header = nullptr;
+  }
+
+  /**
+   * @brief The next record, read in place.
+   *
+   * @return nullptr if no new record is published yet. The record may be
+   * overwritten while it is used, check stillValid() afterwards or copy it
+   * with read().
+   */
+  const mmWaveShmRecord* next() {
+    for (;;) {
+      const mmWaveShmRecord& slot = _records[_cursor & _mask];
+      uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+      if (sequence == 2 * _cursor + 2) {
+        _current = &slot;
+        _cursor++;
+        return _current;
+      }
+      if (sequence < 2 * _cursor + 2)
+        return nullptr;  // not written yet, or being written
+
+      // Lapped by the writer: resume with the oldest record still kept
+      uint64_t published = _header->published.load(std::memory_order_acquire);
+      uint64_t oldest    = published - _mask;  // leave the slot being written
+      _lost += oldest - _cursor;
+      _cursor = oldest;
+    }
+  }
+
+  /* The record returned by the last next() was not overwritten since */
+  bool stillValid() const {
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return _current && _current->sequence.load(std::memory_order_relaxed) ==
+                           2 * (_cursor - 1) + 2;
+  }
+
+  /**
+   * @brief Copy the next record out of the ring.
+   *
+   * @return false if no new record is published yet.
+   */
+  bool read(uint16_t& type, uint8_t* data, uint16_t& length,
+            uint64_t& timestamp_ns) {
+    for (;;) {
+      const mmWaveShmRecord* record = next();
+      if (!record)
+        return false;
+      type         = record->type;
+      length       = record->length;
+      timestamp_ns = record->timestamp_ns;
+      if (length <= MMWAVE_MAX_FRAME_DATA)
+        memcpy(data, record->data, length);
+      if (stillValid() && length <= MMWAVE_MAX_FRAME_DATA)
+        return true;
+      _lost++;
+    }
+  }
+
+  /* Records skipped because the writer lapped this reader */
+  uint64_t lost() const {
+    return _lost;
+  }
+  const mmWaveShmHeader* header() const {
+    return _header;
+  }
+};
+
+#endif /*MMWAVE_HOST_SHM_H*/
@@ -0,0 +1,89 @@
+"""Reader for the shared-memory ring published by mmwave_shmd.
+
+Layout and seqlock protocol are described in mmwave_shm.h. Each reader keeps
+its own cursor, so any number of processes can follow the radar at once:
+
+    reader = MmWaveShmReader()
+    while True:
+        record = reader.next()
+        if record is None:
+            time.sleep(0.005)
+            continue
+        frame_type, timestamp_ns, payload = record
+        if frame_type == POINT_CLOUD:
+            targets = decode_fall_cloud(payload)
+"""
+
+import mmap
+import os
+import struct
+
+SHM_MAGIC = 0x56574D4D
+SHM_VERSION = 1
+
+POINT_CLOUD = 0x0A08
+TARGET_INFO = 0x0A04
+
+_HEADER = struct.Struct("<IHHIIQQQi")
+_RECORD = struct.Struct("<QQHHHH")
+_SEQUENCE = struct.Struct("<Q")
+_FALL_POINT = struct.Struct("<iffff")
+
+
+class MmWaveShmReader:
+    def __init__(self, name="/mmwave"):
+        with open("/dev/shm/" + name.lstrip("/"), "rb") as f:
+            self._map = mmap.mmap(f.fileno(), 0, prot=mmap.PROT_READ)
+        (magic, version, header_size, record_size, slot_count, published,
+         _, _, _) = _HEADER.unpack_from(self._map, 0)
+        if magic != SHM_MAGIC or version != SHM_VERSION:
+            raise ValueError("not an mmWave ring, or a different version")
+        self._header_size = header_size
+        self._record_size = record_size
+        self._mask = slot_count - 1
+        self.cursor = published
+        self.lost = 0
+
+    def _published(self):
+        return _HEADER.unpack_from(self._map, 0)[5]
+
+    def next(self):
+        """Return (type, timestamp_ns, payload) or None if nothing is new."""
+        while True:
+            offset = (self._header_size +
+                      (self.cursor & self._mask) * self._record_size)
+            expected = 2 * self.cursor + 2
+            sequence, timestamp, frame_type, _, length, _ = \
+                _RECORD.unpack_from(self._map, offset)
+            if sequence < expected:
+                return None
+            if sequence == expected:
+                start = offset + _RECORD.size
+                payload = self._map[start:start + length]
+                if _SEQUENCE.unpack_from(self._map, offset)[0] == expected:
+                    self.cursor += 1
+                    return frame_type, timestamp, payload
+            # lapped by the writer, resume with the oldest record kept
+            oldest = self._published() - self._mask
+            self.lost += oldest - self.cursor
+            self.cursor = oldest
+
+    def close(self):
+        self._map.close()
+
+
+def decode_fall_cloud(payload):
+    """Decode an MR60FDA2 point cloud into the dicts of the JSON demos."""
+    if len(payload) < 4:
+        return []
+    count = struct.unpack_from("<i", payload, 0)[0]
+    if count < 0 or 4 + count * _FALL_POINT.size != len(payload):
+        return []
+    targets = []
+    for i in range(count):
+        cluster, x, y, z, dop = _FALL_POINT.unpack_from(
+            payload, 4 + i * _FALL_POINT.size)
+        targets.append({"target_id": i + 1, "x_point": x, "y_point": y,
+                        "z_point": z, "dop_index": dop,
+                        "cluster_index": cluster, "move_speed": dop * 100})
+    return targets
@@ -0,0 +1,86 @@
+/**
+ * @file mmwave_shmd.cpp
+ * @date  18 October 2026
+ *
+ * @note Ingest daemon: reads the radar from a serial port or pty and
+ * publishes every valid frame into the shared-memory ring of mmwave_shm.h.
+ *
+ * @copyright © 2024, Seeed Studio
+ *
+ * @attention Only this process opens the port; any number of consumers
+ * attach to the ring with mmWaveShmReader or mmwave_shm.py. The port is
+ * reopened when it goes away, e.g. when the board is reset. A file or pipe
+ * that is not a terminal is read once, to replay a capture.
+ *   g++ -std=c++11 -O2 -I../../src mmwave_shmd.cpp \
+ *       ../../src/SeeedmmWaveFrame.cpp -o mmwave_shmd -lrt
+ *   ./mmwave_shmd /dev/ttyACM0 [baud] [segment name]
+ */
+
+#include <errno.h>
+#include <signal.h>
+
+#include <cstdio>
+#include <cstdlib>
+
+#include "host_serial.h"
+#include "mmwave_shm.h"
+
+static volatile sig_atomic_t stop = 0;
+
+static void onSignal(int) {
+  stop = 1;
+}
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    fprintf(stderr, "usage: %s device [baud] [segment name]\n", argv[0]);
+    return 2;
+  }
+  const char* device = argv[1];
+  long baud          = argc > 2 ? atol(argv[2]) : 115200;
+  const char* name   = argc > 3 ? argv[3] : MMWAVE_SHM_NAME;
+
+  struct sigaction action;
+  memset(&action, 0, sizeof(action));
+  action.sa_handler = onSignal;  // no SA_RESTART, so read() returns
+  sigaction(SIGINT, &action, nullptr);
+  sigaction(SIGTERM, &action, nullptr);
+
+  mmWaveShmWriter writer;
+  if (!writer.create(name)) {
+    perror(name);
+    return 1;
+  }
+
+  mmWaveFrameParser parser;
+  uint64_t checksum_errors = 0;
+  uint8_t chunk[4096];
+  while (!stop) {
+    int fd = mmWaveHostOpenSerial(device, baud, O_RDONLY);
+    if (fd < 0) {
+      perror(device);
+      sleep(1);
+      continue;
+    }
+    bool tty = isatty(fd);
+    parser.reset();
+    ssize_t n;
+    while (!stop && (n = read(fd, chunk, sizeof(chunk))) > 0) {
+      for (ssize_t i = 0; i < n; i++) {
+        if (!parser.push(chunk[i]))
+          continue;
+        if (mmWaveValidateFrame(parser.frame(), parser.length()))
+          writer.publish(parser.frame());
+        else
+          checksum_errors++;
+      }
+      writer.setErrors(parser.droppedFrames(), checksum_errors);
+    }
+    close(fd);
+    if (!tty)
+      break;  // end of a capture file or pipe
+    if (!stop)
+      sleep(1);  // port gone, wait for it to come back
+  }
+  return 0;
+}
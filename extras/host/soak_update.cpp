@@ -0,0 +1,174 @@
+/**
+ * @file soak_update.cpp
+ * @date  18 October 2026
+ *
+ * @note Soak test of SeeedmmWave::update() against the emulator.
+ *
+ * @copyright © 2024, Seeed Studio
+ *
+ * @attention The library is built for the host with the minimal Arduino
+ * core in arduino/ and reads an emulated MR60FDA2 through an in-memory
+ * serial port, so it is driven far above the rate of a real module. The
+ * run checks that the commands are answered, that every intact fall report
+ * reaches getFall() as long as the receive buffer does not overrun and that
+ * clouds keep arriving despite the corruption, and reports the frame rate
+ * handled.
+ *   g++ -std=gnu++11 -O2 -Iarduino -I../../src soak_update.cpp \
+ *       arduino/Arduino.cpp ../../src/S*.cpp -o soak_update
+ *   ./soak_update [seconds] [cloud_hz] [corrupt_ratio]
+ * Built with -DMMWAVE_TRACE=1 it also writes the last trace events to
+ * soak_update.trace, see trace2chrome.cpp.
+ */
+
+#include <stdlib.h>
+
+#include <cstdio>
+
+#include "Seeed_Arduino_mmWave.h"
+#include "mmwave_emulator.h"
+
+/* The emulator behind a serial port with the receive buffer of the UART
+ * driver, bytes move when the library asks */
+class EmulatedSerial : public HardwareSerial {
+ private:
+  mmWaveEmulator& _emulator;
+
+ public:
+  explicit EmulatedSerial(mmWaveEmulator& emulator) : _emulator(emulator) {}
+
+  int available() override {
+    _emulator.advance(millis());
+    return _emulator.pending();
+  }
+  int read() override {
+    uint8_t byte;
+    return _emulator.read(&byte, 1) ? byte : -1;
+  }
+  size_t readBytes(uint8_t* buffer, size_t length) override {
+    return _emulator.read(buffer, length);
+  }
+  size_t write(const uint8_t* buffer, size_t size) override {
+    _emulator.receive(buffer, size, millis());
+    return size;
+  }
+  int availableForWrite() override {
+    return 4096;
+  }
+  using HardwareSerial::write;
+};
+
+/* Counts the fall reports as they are handled */
+class SoakMR60FDA2 : public SEEED_MR60FDA2 {
+ public:
+  uint64_t falls = 0;
+
+  bool handleType(uint16_t type, const uint8_t* data,
+                  size_t data_len) override {
+    bool handled = SEEED_MR60FDA2::handleType(type, data, data_len);
+    if (handled &&
+        type == static_cast<uint16_t>(TypeFallDetection::ReportFallDetection) &&
+        getFall())
+      falls++;
+    return handled;
+  }
+};
+
+int main(int argc, char** argv) {
+  uint32_t seconds = argc > 1 ? atoi(argv[1]) : 10;
+
+  double cloud_hz = argc > 2 ? atof(argv[2]) : 20000;
+
+  // Quiet while the commands are answered, fetchType() waits a second each
+  mmWaveEmulatorConfig config;
+  config.cloud_hz      = 0;
+  config.state_hz      = 0;
+  config.targets       = 20;
+  config.fall_ratio    = 0.5;
+  config.corrupt_ratio = argc > 3 ? atof(argv[3]) : 0.01;
+  config.latency_ms    = 2;
+  config.rx_buffer     = MMWAVE_RX_BUFFER_SIZE;
+  mmWaveEmulator emulator(config);
+  EmulatedSerial serial(emulator);
+
+  SoakMR60FDA2 mmWave;
+  mmWave.begin(&serial);
+  mmWave.setUserLog(1);
+  mmWave.setLazyDecode(true);
+
+  int failures = 0;
+  float height, threshold, rect_XL, rect_XR, rect_ZF, rect_ZB;
+  uint32_t sensitivity;
+  if (!mmWave.setInstallationHeight(2.8f) || !mmWave.setSensitivity(5) ||
+      !mmWave.getRadarParameters(height, threshold, sensitivity, rect_XL,
+                                 rect_XR, rect_ZF, rect_ZB) ||
+      height != 2.8f || sensitivity != 5) {
+    printf("FAIL: commands not answered\n");
+    failures++;
+  }
+
+  uint64_t clouds = 0, points = 0, loops = 0;
+  PeopleCounting cloud;
+  mmWaveReserveCloud(cloud);
+  uint32_t start = millis();
+  emulator.setRates(cloud_hz, cloud_hz / 10, start);
+  while (millis() - start < seconds * 1000) {
+    mmWave.update(1);
+    loops++;
+    if (mmWave.getPeopleCountingPointCloud(cloud)) {
+      clouds++;
+      points += cloud.targets.size();
+    }
+  }
+  // Drain what is still queued
+  while (mmWave.queuedFrames() > 0) {
+    mmWave.processQueuedFrames(0xFFFF, 10);
+  }
+
+#if MMWAVE_TRACE
+  std::vector<uint8_t> trace(mmWaveTracer.dumpSize());
+  FILE* file = fopen("soak_update.trace", "wb");
+  if (file) {
+    fwrite(trace.data(), 1, mmWaveTracer.dump(trace.data(), trace.size()),
+           file);
+    fclose(file);
+  }
+#endif
+
+  const mmWaveEmulatorStats& stats = emulator.stats();
+  double elapsed = (millis() - start) / 1000.0;
+  printf("%.1f s, %llu loops: %.0f frames/s generated, %llu corrupted\n",
+         elapsed, static_cast<unsigned long long>(loops),
+         stats.frames / elapsed,
+         static_cast<unsigned long long>(stats.corrupted));
+  printf("falls %llu of %llu, clouds read %llu of %llu (%llu coalesced), "
+         "%.1f points each\n",
+         static_cast<unsigned long long>(mmWave.falls),
+         static_cast<unsigned long long>(stats.falls),
+         static_cast<unsigned long long>(clouds),
+         static_cast<unsigned long long>(stats.clouds),
+         static_cast<unsigned long long>(mmWave.coalescedFrames()),
+         clouds ? static_cast<double>(points) / clouds : 0.0);
+  printf("dropped: alarm %u, bulk %u, %llu bytes overrun\n",
+         mmWave.droppedFrames(mmWavePriority::Alarm),
+         mmWave.droppedFrames(mmWavePriority::Bulk),
+         static_cast<unsigned long long>(stats.overrun));
+  const mmWaveSequenceStats& sequence = mmWave.sequenceStats();
+  printf(
+      "ids: %u lost in %u gaps, %u duplicates, %u reordered, %u stale, "
+      "%u resyncs\n",
+      sequence.lost, sequence.gaps, sequence.duplicates, sequence.reordered,
+      sequence.stale, sequence.resyncs);
+
+  // A corrupted frame can swallow the frames after it, only an intact
+  // stream that was read in time has to deliver every fall
+  if (config.corrupt_ratio == 0 && stats.overrun == 0 &&
+      mmWave.falls != stats.falls) {
+    printf("FAIL: fall reports lost\n");
+    failures++;
+  }
+  if (clouds == 0) {
+    printf("FAIL: no point cloud decoded\n");
+    failures++;
+  }
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,62 @@
+/**
+ * @file stream_cat.cpp
+ * @date  18 October 2026
+ *
+ * @note Print the point clouds of a binary stream as CSV.
+ *
+ * @copyright © 2024, Seeed Studio
+ *
+ * @attention Reads the output of examples/PointCloudStream from a serial
+ * port, or from stdin when no port is given, and prints one line per point:
+ * sequence,timestamp,index,x,y,z,doppler,cluster. Records lost on the link
+ * are reported on stderr.
+ *   g++ -std=c++11 -O2 -I../../src stream_cat.cpp \
+ *       ../../src/SeeedmmWaveStream.cpp ../../src/SeeedmmWaveFrame.cpp \
+ *       -o stream_cat && ./stream_cat /dev/ttyACM0 115200
+ */
+
+#include <cstdio>
+#include <cstdlib>
+
+#include "SeeedmmWaveStream.h"
+#include "host_serial.h"
+
+int main(int argc, char** argv) {
+  int fd = 0;
+  if (argc > 1) {
+    fd = mmWaveHostOpenSerial(argv[1], argc > 2 ? atol(argv[2]) : 115200,
+                              O_RDONLY);
+    if (fd < 0) {
+      perror(argv[1]);
+      return 1;
+    }
+  }
+
+  mmWaveStreamDecoder decoder;
+  bool first        = true;
+  uint16_t expected = 0;
+  uint8_t chunk[4096];
+  ssize_t n;
+  while ((n = read(fd, chunk, sizeof(chunk))) > 0) {
+    for (ssize_t i = 0; i < n; i++) {
+      if (!decoder.push(chunk[i]))
+        continue;
+      const mmWaveStreamRecord& record = decoder.record();
+      if (!first && record.sequence != expected)
+        fprintf(stderr, "lost %u records\n",
+                static_cast<uint16_t>(record.sequence - expected));
+      first    = false;
+      expected = record.sequence + 1;
+      for (size_t p = 0; p < record.cloud.targets.size(); p++) {
+        const TargetN& t = record.cloud.targets[p];
+        printf("%u,%u,%zu,%.3f,%.3f,%.3f,%.3f,%d\n", record.sequence,
+               record.timestamp, p, t.x_point, t.y_point, t.z_point,
+               t.dop_index, t.cluster_index);
+      }
+      fflush(stdout);
+    }
+  }
+  if (decoder.errors())
+    fprintf(stderr, "%u corrupt records\n", decoder.errors());
+  return 0;
+}
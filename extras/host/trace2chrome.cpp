@@ -0,0 +1,106 @@
+/**
+ * @file trace2chrome.cpp
+ * @date  18 October 2026
+ *
+ * @note Convert trace dumps of the library into Chrome trace JSON.
+ *
+ * @copyright © 2024, Seeed Studio
+ *
+ * @attention Reads a capture holding one or more mmWaveTraceRing::dump()
+ * outputs, from a file or stdin, and writes the events as Chrome trace JSON
+ * to stdout. Anything else in the capture, e.g. text printed by the sketch,
+ * is skipped. Open the result in chrome://tracing or ui.perfetto.dev.
+ *   g++ -std=c++11 -O2 -I../../src trace2chrome.cpp \
+ *       ../../src/SeeedmmWaveTrace.cpp -o trace2chrome
+ *   ./trace2chrome capture.bin > trace.json
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "SeeedmmWaveTrace.h"
+
+static uint32_t load(const uint8_t* in, size_t bytes) {
+  uint32_t value = 0;
+  for (size_t i = 0; i < bytes; i++) {
+    value |= static_cast<uint32_t>(in[i]) << (8 * i);
+  }
+  return value;
+}
+
+int main(int argc, char** argv) {
+  FILE* in = argc > 1 ? fopen(argv[1], "rb") : stdin;
+  if (!in) {
+    perror(argv[1]);
+    return 1;
+  }
+  std::vector<uint8_t> capture;
+  uint8_t chunk[4096];
+  size_t n;
+  while ((n = fread(chunk, 1, sizeof(chunk), in)) > 0) {
+    capture.insert(capture.end(), chunk, chunk + n);
+  }
+
+  // micros() wraps after 71 minutes, keep the time monotonic
+  uint64_t epoch = 0;
+  uint32_t last  = 0;
+  bool first     = true;
+  size_t dumps   = 0;
+  size_t events  = 0;
+  uint32_t lost  = 0;
+
+  printf("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+  printf("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,"
+         "\"args\":{\"name\":\"mmWave\"}}");
+  size_t at = 0;
+  while (at + MMWAVE_TRACE_HEADER_SIZE <= capture.size()) {
+    const uint8_t* header = capture.data() + at;
+    if (load(header, 4) != MMWAVE_TRACE_MAGIC ||
+        header[4] != MMWAVE_TRACE_VERSION ||
+        header[5] != sizeof(mmWaveTraceRecord)) {
+      at++;
+      continue;
+    }
+    uint32_t count = load(header + 8, 4);
+    if (capture.size() - at - MMWAVE_TRACE_HEADER_SIZE <
+        static_cast<size_t>(count) * sizeof(mmWaveTraceRecord)) {
+      fprintf(stderr, "truncated dump at offset %zu\n", at);
+      break;
+    }
+    lost += load(header + 12, 4);
+    dumps++;
+
+    const uint8_t* record = header + MMWAVE_TRACE_HEADER_SIZE;
+    for (uint32_t i = 0; i < count; i++, record += sizeof(mmWaveTraceRecord)) {
+      uint32_t time = load(record, 4);
+      if (!first && time < last && last - time > 0x80000000UL)
+        epoch += 0x100000000ULL;
+      first = false;
+      last  = time;
+
+      uint16_t type   = load(record + 4, 2);
+      uint16_t length = load(record + 6, 2);
+      char phase      = static_cast<char>(record[9]);
+      if (phase != 'B' && phase != 'E' && phase != 'i')
+        continue;
+      printf(",\n{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%llu,\"pid\":1,"
+             "\"tid\":1,",
+             mmWaveTraceEventName(record[8]), phase,
+             static_cast<unsigned long long>(epoch + time));
+      if (phase == 'i')
+        printf("\"s\":\"t\",");
+      if (type == 0xFFFF)
+        printf("\"args\":{\"length\":%u}}", length);
+      else
+        printf("\"args\":{\"type\":\"0x%04X\",\"length\":%u}}", type, length);
+      events++;
+    }
+    at = record - capture.data();
+  }
+  printf("\n]}\n");
+
+  fprintf(stderr, "%zu dumps, %zu events, %u overwritten before dumping\n",
+          dumps, events, lost);
+  return dumps ? 0 : 1;
+}
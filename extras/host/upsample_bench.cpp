@@ -0,0 +1,132 @@
+/**
+ * @file upsample_bench.cpp
+ * @date  18 October 2026
+ *
+ * @note Time mmWaveUpsampler on synthetic point clouds of 64 to 4096 points.
+ *
+ * @copyright © 2024, Seeed Studio
+ *
+ * @attention Each cloud is a few people, upright blobs of points standing
+ * on the floor of a room, with a little noise. Both methods are run until
+ * about 200 ms have passed and the mean time per cloud is printed, next to
+ * the brute-force neighbour search of the Python script. The neighbours
+ * found by midpoints() are checked against the brute-force ones. The upsampler does not need Arduino:
+ *   g++ -std=gnu++11 -O2 -I../../src upsample_bench.cpp \
+ *       ../../src/SeeedmmWaveUpsample.cpp -o upsample_bench
+ *   ./upsample_bench [max points]
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <algorithm>
+
+#include "SeeedmmWaveUpsample.h"
+
+static double nowUs() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static float frand(uint32_t& seed) {
+  seed = seed * 1664525u + 1013904223u;
+  return (seed >> 8) * (1.0f / 16777216.0f);
+}
+
+static void makeCloud(size_t count, PeopleCounting& cloud) {
+  uint32_t seed = 12345 + count;
+  size_t people = 1 + count / 256;
+  if (people > 6)
+    people = 6;
+  cloud.targets.clear();
+  for (size_t i = 0; i < count; i++) {
+    size_t person = i % people;
+    TargetN point;
+    point.x_point       = -2.0f + person * 0.8f + 0.3f * frand(seed);
+    point.y_point       = 1.0f + person * 0.5f + 0.3f * frand(seed);
+    point.z_point       = 1.8f * frand(seed);
+    point.dop_index     = person * 0.5f - 1.0f + 0.2f * frand(seed);
+    point.cluster_index = person;
+    cloud.targets.push_back(point);
+  }
+}
+
+/* The neighbour search of the script, every pair */
+static void bruteNearest(const PeopleCounting& cloud, size_t query, size_t k,
+                         std::vector<std::pair<float, size_t> >& found) {
+  const TargetN& p = cloud.targets[query];
+  found.clear();
+  for (size_t j = 0; j < cloud.targets.size(); j++) {
+    if (j == query)
+      continue;
+    float dx = cloud.targets[j].x_point - p.x_point;
+    float dy = cloud.targets[j].y_point - p.y_point;
+    float dz = cloud.targets[j].z_point - p.z_point;
+    found.push_back(std::make_pair(dx * dx + dy * dy + dz * dz, j));
+  }
+  std::partial_sort(found.begin(), found.begin() + k, found.end());
+  found.resize(k);
+}
+
+template <typename F>
+static double timeUs(F run) {
+  size_t rounds = 0;
+  double start = nowUs(), end;
+  do {
+    run();
+    rounds++;
+    end = nowUs();
+  } while (end - start < 200000);
+  return (end - start) / rounds;
+}
+
+int main(int argc, char** argv) {
+  size_t max_points = argc > 1 ? strtoul(argv[1], nullptr, 0) : 4096;
+
+  mmWaveUpsampler upsampler;
+  if (!upsampler.begin(max_points, 3)) {
+    fprintf(stderr, "bad point count %zu\n", max_points);
+    return 2;
+  }
+  PeopleCounting cloud, dense;
+  dense.targets.reserve(upsampler.capacity());
+  std::vector<std::pair<float, size_t> > reference;
+
+  printf("%6s %12s %12s %12s %8s\n", "points", "midpoint_us", "mls_us",
+         "brute_knn_us", "added");
+  for (size_t count = 64; count <= max_points; count *= 2) {
+    makeCloud(count, cloud);
+
+    // With k = 2 and no noise every new point is the midpoint of the two
+    // nearest neighbours
+    upsampler.setNoise(0, 0);
+    upsampler.midpoints(cloud, dense, 2);
+    size_t mismatches = 0;
+    for (size_t i = 0; i < count; i++) {
+      bruteNearest(cloud, i, 2, reference);
+      const TargetN& a    = cloud.targets[reference[0].second];
+      const TargetN& b    = cloud.targets[reference[1].second];
+      const TargetN& made = dense.targets[count + 2 * i];
+      if (fabsf((a.x_point + b.x_point) * 0.5f - made.x_point) > 1e-5f ||
+          fabsf((a.y_point + b.y_point) * 0.5f - made.y_point) > 1e-5f ||
+          fabsf((a.z_point + b.z_point) * 0.5f - made.z_point) > 1e-5f)
+        mismatches++;
+    }
+    upsampler.setNoise(0.02f, 0.1f);
+
+    double midpoint_us = timeUs([&] { upsampler.midpoints(cloud, dense); });
+    size_t added       = upsampler.mls(cloud, dense);
+    double mls_us      = timeUs([&] { upsampler.mls(cloud, dense); });
+    double brute_us    = timeUs([&] {
+      for (size_t i = 0; i < count; i++) {
+        bruteNearest(cloud, i, 2, reference);
+      }
+    });
+    printf("%6zu %12.1f %12.1f %12.1f %8zu%s\n", count, midpoint_us, mls_us,
+           brute_us, added, mismatches ? "  NEIGHBOUR MISMATCH" : "");
+  }
+  return 0;
+}
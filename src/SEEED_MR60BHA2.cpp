@@ -1,5 +1,40 @@
 #include "SEEED_MR60BHA2.h"
 
+/**
+ * @brief Presence events take the alarm lane and are all handled. Vital
+ * signs and distance are state reports, point clouds take the bulk lane;
+ * only the newest queued frame of each is handled.
+ */
+SEEED_MR60BHA2::SEEED_MR60BHA2() {
+  static const struct {
+    TypeHeartBreath type;
+    mmWavePriority priority;
+    mmWaveQueuePolicy policy;
+  } kPolicies[] = {
+      {TypeHeartBreath::ReportHumanDetection, mmWavePriority::Alarm,
+       mmWaveQueuePolicy::KeepAll},
+      {TypeHeartBreath::TypeHeartBreathPhase, mmWavePriority::State,
+       mmWaveQueuePolicy::LatestOnly},
+      {TypeHeartBreath::TypeBreathRate, mmWavePriority::State,
+       mmWaveQueuePolicy::LatestOnly},
+      {TypeHeartBreath::TypeHeartRate, mmWavePriority::State,
+       mmWaveQueuePolicy::LatestOnly},
+      {TypeHeartBreath::TypeHeartBreathDistance, mmWavePriority::State,
+       mmWaveQueuePolicy::LatestOnly},
+      {TypeHeartBreath::Report3DPointCloudDetection, mmWavePriority::Bulk,
+       mmWaveQueuePolicy::LatestOnly},
+      {TypeHeartBreath::Report3DPointCloudTartgetInfo, mmWavePriority::Bulk,
+       mmWaveQueuePolicy::LatestOnly},
+  };
+  for (const auto& entry : kPolicies) {
+    uint16_t type = static_cast<uint16_t>(entry.type);
+    setFramePriority(type, entry.priority);
+    setQueuePolicy(type, entry.policy);
+  }
+  mmWaveReserveCloud(_people_counting_point_cloud);
+  mmWaveReserveCloud(_people_counting_target_info);
+}
+
 /**
  * @brief Handle different types of heart and breath data.
  *
@@ -18,93 +53,61 @@ bool SEEED_MR60BHA2::handleType(uint16_t _type, const uint8_t* data,
   TypeHeartBreath type = static_cast<TypeHeartBreath>(_type);
   switch (type) {
     case TypeHeartBreath::TypeHeartBreathPhase: {
-      _heart_breath.total_phase  = extractFloat(data);
-      _heart_breath.breath_phase = extractFloat(data + sizeof(float));
-      _heart_breath.heart_phase  = extractFloat(data + 2 * sizeof(float));
-      _isHeartBreathPhaseValid   = true;
+      if (!mmWaveBreathSchema<TypeHeartBreath::TypeHeartBreathPhase>::decode(
+              data, data_len, _heart_breath))
+        return false;
+      _isHeartBreathPhaseValid = true;
       break;
     }
     case TypeHeartBreath::TypeBreathRate: {
-      _breath_rate       = extractFloat(data);
+      if (!mmWaveBreathSchema<TypeHeartBreath::TypeBreathRate>::decode(
+              data, data_len, _breath_rate))
+        return false;
       _isBreathRateValid = true;
       break;
     }
     case TypeHeartBreath::TypeHeartRate: {
-      _heart_rate       = extractFloat(data);
+      if (!mmWaveBreathSchema<TypeHeartBreath::TypeHeartRate>::decode(
+              data, data_len, _heart_rate))
+        return false;
       _isHeartRateValid = true;
       break;
     }
     case TypeHeartBreath::TypeHeartBreathDistance: {
-      _rangeFlag       = extractU32(data);
-      _range           = extractFloat(data + sizeof(uint32_t));
+      if (!mmWaveBreathSchema<TypeHeartBreath::TypeHeartBreathDistance>::decode(
+              data, data_len, _distance))
+        return false;
       _isDistanceValid = true;
       break;
     }
     case TypeHeartBreath::ReportHumanDetection: {
-      _isHumanDetected = data[0];
+      if (!mmWaveBreathSchema<TypeHeartBreath::ReportHumanDetection>::decode(
+              data, data_len, _isHumanDetected))
+        return false;
       _isHumanDetectionValid = true;
       break;
     }
     case TypeHeartBreath::Report3DPointCloudDetection: {
-      size_t target_num = extractU32(data);  // Extract target quantity
-      data += sizeof(uint32_t);
-
-      std::vector<TargetN> received_targets; // Used to store parsed target data
-      received_targets.reserve(target_num);
-
-      for(size_t i = 0; i < target_num; i++)
-      {
-        TargetN target;
-        target.x_point = extractFloat(data);
-        data += sizeof(float);
-
-        target.y_point = extractFloat(data);
-        data += sizeof(float);
-
-        target.dop_index = extractU32(data);
-        data += sizeof(int32_t);
-
-        target.cluster_index = extractU32(data);
-        data += sizeof(int32_t);
-
-        received_targets.push_back(target); // Add the resolved target to the container
-      }
-
-      // Store the received target data in the PeopleCounting object
-      _people_counting_point_cloud.targets = std::move(received_targets);
+      typedef mmWaveBreathSchema<TypeHeartBreath::Report3DPointCloudDetection>
+          Schema;
+      if (_lazy_decode ? !_point_cloud_view.store(data, data_len)
+                       : !Schema::decode(data, data_len,
+                                         _people_counting_point_cloud.targets,
+                                         _roi, _rejected_points))
+        return false;  // target count does not match the payload length
+      if (!_lazy_decode && _clutter)
+        _clutter->filter(_people_counting_point_cloud);
       _isPeopleCountingPointCloudValid = true;
-
       break;
     }
     case TypeHeartBreath::Report3DPointCloudTartgetInfo: {
-      size_t target_num = extractU32(data);  // Extract target quantity
-      data += sizeof(uint32_t);
-
-      std::vector<TargetN> received_targets; // Used to store parsed target data
-      received_targets.reserve(target_num);
-
-      for(size_t i = 0; i < target_num; i++)
-      {
-        TargetN target;
-        target.x_point = extractFloat(data);
-        data += sizeof(float);
-
-        target.y_point = extractFloat(data);
-        data += sizeof(float);
-
-        target.dop_index = extractU32(data);
-        data += sizeof(int32_t);
-
-        target.cluster_index = extractU32(data);
-        data += sizeof(int32_t);
-
-        received_targets.push_back(target); // Add the resolved target to the container
-      }
-
-      // Store the received target data in the PeopleCounting object
-      _people_counting_target_info.targets = std::move(received_targets);
+      typedef mmWaveBreathSchema<TypeHeartBreath::Report3DPointCloudTartgetInfo>
+          Schema;
+      if (_lazy_decode ? !_target_info_view.store(data, data_len)
+                       : !Schema::decode(data, data_len,
+                                         _people_counting_target_info.targets))
+        return false;
       _isPeopleCountingTartgetInfoValid = true;
-
       break;
     }
     default:
@@ -143,26 +146,75 @@ bool SEEED_MR60BHA2::getHeartRate(float& rate) {
 }
 
 bool SEEED_MR60BHA2::getDistance(float& distance) {
-  if (!_isDistanceValid || !_rangeFlag)
+  if (!_isDistanceValid || !_distance.flag)
     return false;
   _isDistanceValid = false;
-  distance         = _range;
+  distance         = _distance.range;
   return true;
 }
 
+/**
+ * @brief Get the newest point cloud, see
+ * SEEED_MR60FDA2::getPeopleCountingPointCloud(). With MMWAVE_STATIC_MEMORY
+ * reserve `point_cloud` with mmWaveReserveCloud().
+ */
 bool SEEED_MR60BHA2::getPeopleCountingPointCloud(PeopleCounting& point_cloud) {
   if (!_isPeopleCountingPointCloudValid)
     return false;
   _isPeopleCountingPointCloudValid = false;
-  point_cloud = std::move(_people_counting_point_cloud);
+  if (_lazy_decode) {
+    if (!_point_cloud_view.decode(point_cloud.targets, _roi, _rejected_points))
+      return false;
+    if (_clutter)
+      _clutter->filter(point_cloud);
+    return true;
+  }
+  mmWaveTakeCloud(_people_counting_point_cloud, point_cloud);
   return true;
 }
 
+/* Same for the target info, reserve `target_info` the same way */
 bool SEEED_MR60BHA2::getPeopleCountingTartgetInfo(PeopleCounting& target_info) {
   if (!_isPeopleCountingTartgetInfoValid)
     return false;
   _isPeopleCountingTartgetInfoValid = false;
-  target_info = std::move(_people_counting_target_info);
+  if (_lazy_decode)
+    return _target_info_view.decode(target_info.targets);
+  mmWaveTakeCloud(_people_counting_target_info, target_info);
+  return true;
+}
+
+/**
+ * @brief Keep point clouds as raw payloads and decode them on access, see
+ * SEEED_MR60FDA2::setLazyDecode().
+ */
+void SEEED_MR60BHA2::setLazyDecode(bool lazy) {
+  _lazy_decode                      = lazy;
+  _isPeopleCountingPointCloudValid  = false;
+  _isPeopleCountingTartgetInfoValid = false;
+}
+
+/**
+ * @brief Remove static reflectors from the point clouds, see
+ * SEEED_MR60FDA2::setClutterMap().
+ */
+void SEEED_MR60BHA2::setClutterMap(mmWaveClutterMap* clutter) {
+  _clutter = clutter;
+}
+
+bool SEEED_MR60BHA2::getPointCloudView(const mmWaveBreathCloudView*& view) {
+  if (!_lazy_decode || !_isPeopleCountingPointCloudValid)
+    return false;
+  _isPeopleCountingPointCloudValid = false;
+  view                             = &_point_cloud_view;
+  return true;
+}
+
+bool SEEED_MR60BHA2::getTargetInfoView(const mmWaveBreathCloudView*& view) {
+  if (!_lazy_decode || !_isPeopleCountingTartgetInfoValid)
+    return false;
+  _isPeopleCountingTartgetInfoValid = false;
+  view                              = &_target_info_view;
   return true;
 }
 
@@ -15,28 +15,13 @@
 
 #include "SeeedmmWave.h"
 #include "SEEED_Public.h"
+#include "SeeedmmWaveClutter.h"
+#include "SeeedmmWaveRoi.h"
+#include "SeeedmmWaveSchema.h"
 #define MAX_TARGET_NUM    3
 
 #define RANGE_STEP 17.28f
 
-enum class TypeHeartBreath : uint16_t {
-  TypeHeartBreathPhase    = 0x0A13,
-  TypeBreathRate          = 0x0A14,
-  TypeHeartRate           = 0x0A15,
-  TypeHeartBreathDistance = 0x0A16,
-  Report3DPointCloudDetection   = 0x0A08,
-  Report3DPointCloudTartgetInfo = 0x0A04,
-  ReportHumanDetection       = 0x0F09,
-};
-
-typedef struct HeartBreath {
-  float total_phase;
-  float breath_phase;
-  float heart_phase;
-} HeartBreath;
-
-
-
 class SEEED_MR60BHA2 : public SeeedmmWave {
  private:
   /* HeartBreath */
@@ -49,8 +34,7 @@ class SEEED_MR60BHA2 : public SeeedmmWave {
   float _heart_rate;
 
   /* HeartBreathDistance */
-  uint32_t _rangeFlag;
-  float _range;
+  HeartBreathDistance _distance;
 
   /* HumanDetection */
   bool _isHumanDetected;             // 0 : no one            1 : There is someone
@@ -58,11 +42,23 @@ class SEEED_MR60BHA2 : public SeeedmmWave {
 
   /* PeopleCounting PointCloud */
   PeopleCounting _people_counting_point_cloud;
-  bool _isPeopleCountingPointCloudValid;
+  bool _isPeopleCountingPointCloudValid = false;
  
   /* PeopleCounting TartgetInfo */
   PeopleCounting _people_counting_target_info;
-  bool _isPeopleCountingTartgetInfoValid;
+  bool _isPeopleCountingTartgetInfoValid = false;
+
+  /* Raw clouds kept by setLazyDecode() */
+  bool _lazy_decode = false;
+  mmWaveBreathCloudView _point_cloud_view;
+  mmWaveBreathCloudView _target_info_view;
+
+  /* Points outside it are dropped while the point cloud is decoded */
+  mmWaveRoiFilter _roi;
+  uint32_t _rejected_points = 0;
+
+  /* Static reflectors removed after decoding, optional */
+  mmWaveClutterMap* _clutter = nullptr;
 
   bool _isHeartBreathPhaseValid = false;
   bool _isBreathRateValid       = false;
@@ -70,7 +66,13 @@ class SEEED_MR60BHA2 : public SeeedmmWave {
   bool _isDistanceValid         = false;
 
  public:
-  SEEED_MR60BHA2() {}
+#if MMWAVE_STATIC_MEMORY
+  static constexpr size_t kReservedBytes =
+      2 * MMWAVE_MAX_POINTS * sizeof(TargetN) +
+      2 * mmWaveReservedBytes<mmWaveBreathCloudView>::value;
+#endif
+
+  SEEED_MR60BHA2();
 
   virtual ~SEEED_MR60BHA2() {}
 
@@ -84,6 +86,23 @@ class SEEED_MR60BHA2 : public SeeedmmWave {
   bool getDistance(float& distance);
   bool getPeopleCountingPointCloud(PeopleCounting& point_cloud);
   bool getPeopleCountingTartgetInfo(PeopleCounting& target_info);
+
+  void setLazyDecode(bool lazy);
+  bool getPointCloudView(const mmWaveBreathCloudView*& view);
+  bool getTargetInfoView(const mmWaveBreathCloudView*& view);
+
+  void setRoi(const mmWaveRoiFilter& roi) {
+    _roi = roi;
+  }
+  const mmWaveRoiFilter& getRoi() const {
+    return _roi;
+  }
+  /* Points of the last decoded cloud that were outside the ROI */
+  uint32_t getRejectedPoints() const {
+    return _rejected_points;
+  }
+
+  void setClutterMap(mmWaveClutterMap* clutter);
   bool isHumanDetected();
 };
 
@@ -11,6 +11,44 @@
 
 #include "SEEED_MR60FDA2.h"
 
+/**
+ * @brief Fall and presence events take the alarm lane and are all handled.
+ * Point clouds take the bulk lane and only the newest queued one is handled.
+ */
+SEEED_MR60FDA2::SEEED_MR60FDA2() {
+  static const struct {
+    TypeFallDetection type;
+    mmWavePriority priority;
+    mmWaveQueuePolicy policy;
+  } kPolicies[] = {
+      {TypeFallDetection::ReportFallDetection, mmWavePriority::Alarm,
+       mmWaveQueuePolicy::KeepAll},
+      {TypeFallDetection::ReportUnmannedDetection, mmWavePriority::Alarm,
+       mmWaveQueuePolicy::KeepAll},
+      {TypeFallDetection::InstallationHeight, mmWavePriority::CommandAck,
+       mmWaveQueuePolicy::KeepAll},
+      {TypeFallDetection::RadarParameters, mmWavePriority::CommandAck,
+       mmWaveQueuePolicy::KeepAll},
+      {TypeFallDetection::FallThreshold, mmWavePriority::CommandAck,
+       mmWaveQueuePolicy::KeepAll},
+      {TypeFallDetection::AlarmParameters, mmWavePriority::CommandAck,
+       mmWaveQueuePolicy::KeepAll},
+      {TypeFallDetection::FallSensitivity, mmWavePriority::CommandAck,
+       mmWaveQueuePolicy::KeepAll},
+      {TypeFallDetection::Report3DPointCloudDetection, mmWavePriority::Bulk,
+       mmWaveQueuePolicy::LatestOnly},
+      {TypeFallDetection::Report3DPointCloudTartgetInfo, mmWavePriority::Bulk,
+       mmWaveQueuePolicy::LatestOnly},
+  };
+  for (const auto& entry : kPolicies) {
+    uint16_t type = static_cast<uint16_t>(entry.type);
+    setFramePriority(type, entry.priority);
+    setQueuePolicy(type, entry.policy);
+  }
+  mmWaveReserveCloud(_people_counting_point_cloud);
+  mmWaveReserveCloud(_people_counting_target_info);
+}
+
 /**
  * @brief Radar initialization.
  *
@@ -40,12 +78,18 @@ bool SEEED_MR60FDA2::resetSetting(void) {
  * @retval true Set height successfully
  * @retval false Failed to set altitude
  *
+ * @note This and the other set*() calls keep their command with
+ * queueConfig(), to send it again after a restart. While bringingUp() they
+ * only queue it and return whether it was queued.
  */
 bool SEEED_MR60FDA2::setInstallationHeight(const float height) {
   uint16_t type = static_cast<uint16_t>(TypeFallDetection::InstallationHeight);
 
   uint8_t data[sizeof(float)] = {0};
   floatToBytes(height, data);
+  bool kept = queueConfig(type, data, sizeof(data));
+  if (bringingUp())
+    return kept;
   if (this->send(type, data, sizeof(data))) {
     return this->fetchType(type, 1000);
   }
@@ -64,6 +108,9 @@ bool SEEED_MR60FDA2::setThreshold(const float threshold) {
 
   uint8_t data[sizeof(float)];
   floatToBytes(threshold, data);
+  bool kept = queueConfig(type, data, sizeof(data));
+  if (bringingUp())
+    return kept;
   if (this->send(type, data, sizeof(data))) {
     if (fetchType(type, 1000))  // Timeout of 5000 ms to fetch the response
     {
@@ -88,6 +135,9 @@ bool SEEED_MR60FDA2::setSensitivity(const uint32_t _sensitivity) {
 
   uint8_t data[sizeof(uint32_t)];
   uint32ToBytes(_sensitivity, data);
+  bool kept = queueConfig(type, data, sizeof(data));
+  if (bringingUp())
+    return kept;
   if (this->send(type, data, sizeof(data))) {
     if (fetchType(type, 1000))  // Timeout of 5000 ms to fetch the response
     {
@@ -115,6 +165,9 @@ bool SEEED_MR60FDA2::setAlamArea(const float rect_XL, const float rect_XR,
   floatToBytes(rect_ZF, data + 2 * sizeof(float));
   floatToBytes(rect_ZB, data + 3 * sizeof(float));
   uint16_t type = static_cast<uint16_t>(TypeFallDetection::AlarmParameters);
+  bool kept = queueConfig(type, data, sizeof(data));
+  if (bringingUp())
+    return kept;
   if (this->send(type, data, sizeof(data))) {
     if (fetchType(type, 1000)) {
       return _isAlarmAreaValid;
@@ -136,9 +189,9 @@ bool SEEED_MR60FDA2::getRadarParameters(float& height, float& threshold,
                                         uint32_t& sensitivity) {
   this->getRadarParameters();
   if (_parametersValid) {
-    height           = _height;
-    threshold        = _thershold;
-    sensitivity      = _sensitivity;
+    height           = _parameters.height;
+    threshold        = _parameters.threshold;
+    sensitivity      = _parameters.sensitivity;
     _parametersValid = false;
     return true;
   }
@@ -164,13 +217,13 @@ bool SEEED_MR60FDA2::getRadarParameters(float& height, float& threshold,
                                         float& rect_ZB) {
   this->getRadarParameters();
   if (_parametersValid) {
-    height           = _height;
-    threshold        = _thershold;
-    sensitivity      = _sensitivity;
-    rect_XL          = _rect_XL;
-    rect_XR          = _rect_XR;
-    rect_ZF          = _rect_ZF;
-    rect_ZB          = _rect_ZB;
+    height           = _parameters.height;
+    threshold        = _parameters.threshold;
+    sensitivity      = _parameters.sensitivity;
+    rect_XL          = _parameters.rect_XL;
+    rect_XR          = _parameters.rect_XR;
+    rect_ZF          = _parameters.rect_ZF;
+    rect_ZB          = _parameters.rect_ZB;
     _parametersValid = false;
     return true;
   }
@@ -191,13 +244,23 @@ bool SEEED_MR60FDA2::getRadarParameters() {
   return false;
 }
 
+/**
+ * @brief Ask for the radar parameters while beginAsync() waits, the module
+ * reports nothing by itself until someone is in view.
+ */
+uint16_t SEEED_MR60FDA2::probeType() const {
+  return static_cast<uint16_t>(TypeFallDetection::RadarParameters);
+}
+
 // Only supports one-way data transmission mode
 bool SEEED_MR60FDA2::setUserLog(bool flag) {
   uint16_t type = static_cast<uint16_t>(TypeFallDetection::UserLogInfo);
 
   uint8_t data[sizeof(uint32_t)] = {0};
   uint32ToBytes(flag, data);
-  std::vector<uint8_t> frame = packetFrame(type, data, sizeof(data));
+  bool kept = queueConfig(type, data, sizeof(data), false);
+  if (bringingUp())
+    return kept;
   if (this->send(type, data, sizeof(data))) {
     return true;
   }
@@ -269,141 +332,175 @@ bool SEEED_MR60FDA2::handleType(uint16_t _type, const uint8_t* data,
   TypeFallDetection type = static_cast<TypeFallDetection>(_type);
   switch (type) {
     case TypeFallDetection::ReportFallDetection:
-      _isFall      = *(const bool*)data;
+      if (!mmWaveFallSchema<TypeFallDetection::ReportFallDetection>::decode(
+              data, data_len, _isFall))
+        return false;
       _isFallValid = true;
+      if (_fall_recorder)
+        _fall_recorder->onFall(millis(), _isFall);
       break;
     case TypeFallDetection::ReportUnmannedDetection:
-      _isHuman      = *(const uint8_t*)data;
+      if (!mmWaveFallSchema<TypeFallDetection::ReportUnmannedDetection>::decode(
+              data, data_len, _isHuman))
+        return false;
       _isHumanValid = true;
+      if (_fall_recorder)
+        _fall_recorder->onHuman(millis(), _isHuman);
       break;
     case TypeFallDetection::InstallationHeight: {
       if (data_len != 1)
         return false;
-      _isHeightValid = *(const uint8_t*)data;
+      mmWaveFallSchema<TypeFallDetection::InstallationHeight>::decode(
+          data, data_len, _isHeightValid);
       break;
     }
     case TypeFallDetection::RadarParameters: {
-      if (data_len <= 1)
+      if (!mmWaveFallSchema<TypeFallDetection::RadarParameters>::decode(
+              data, data_len, _parameters))
         return false;
-      _height          = extractFloat(data);
-      _thershold       = extractFloat(data + sizeof(float));
-      _sensitivity     = extractU32(data + 2 * sizeof(float));
-      _rect_XL         = extractFloat(data + 3 * sizeof(float));
-      _rect_XR         = extractFloat(data + 4 * sizeof(float));
-      _rect_ZF         = extractFloat(data + 5 * sizeof(float));
-      _rect_ZB         = extractFloat(data + 6 * sizeof(float));
       _parametersValid = true;
       break;
     }
     case TypeFallDetection::FallThreshold: {  // set fall threshold result
       if (data_len != 1)
         return false;
-      _isThresholdValid = *(const uint8_t*)data;
+      mmWaveFallSchema<TypeFallDetection::FallThreshold>::decode(
+          data, data_len, _isThresholdValid);
       break;
     }
     case TypeFallDetection::AlarmParameters: {
-      _isAlarmAreaValid = *(const uint8_t*)data;
+      if (!mmWaveFallSchema<TypeFallDetection::AlarmParameters>::decode(
+              data, data_len, _isAlarmAreaValid))
+        return false;
       break;
     }
     case TypeFallDetection::FallSensitivity:
-      _isSensitivityValid = *(const uint8_t*)data;
+      if (!mmWaveFallSchema<TypeFallDetection::FallSensitivity>::decode(
+              data, data_len, _isSensitivityValid))
+        return false;
       break;
-
-      
     case TypeFallDetection::Report3DPointCloudDetection: {
-        int32_t target_num = (int32_t)extractI32(data);  // Extract target quantity
-        data += sizeof(uint32_t);
-
-        std::vector<TargetN> received_targets; // Used to store parsed target data
-        received_targets.reserve(target_num);
-  
-        for(size_t i = 0; i < target_num; i++)
-        {
-          TargetN target;
-          target.cluster_index = extractI32(data);
-          data += sizeof(int32_t);
-
-          target.x_point = extractFloat(data);
-          data += sizeof(float);
-  
-          target.y_point = extractFloat(data);
-          data += sizeof(float);
-
-          target.z_point = extractFloat(data);
-          data += sizeof(float);
-  
-          target.dop_index = extractFloat(data);
-          data += sizeof(float);
-  
-          
-  
-          received_targets.push_back(target); // Add the resolved target to the container
-        }
-  
-        // Store the received target data in the PeopleCounting object
-        _people_counting_point_cloud.targets = std::move(received_targets);
-        _isPeopleCountingPointCloudValid = true;
-  
-        break;
-      }
-
-      case TypeFallDetection::Report3DPointCloudTartgetInfo: {
-        int32_t target_num = (int32_t)extractI32(data);  // Extract target quantity
-        data += sizeof(uint32_t);
-
-        std::vector<TargetN> received_targets; // Used to store parsed target data
-        received_targets.reserve(target_num);
-  
-        for(size_t i = 0; i < target_num; i++)
-        {
-          TargetN target;
-          target.cluster_index = extractI32(data);
-          data += sizeof(int32_t);
-
-          target.x_point = extractFloat(data);
-          data += sizeof(float);
-  
-          target.y_point = extractFloat(data);
-          data += sizeof(float);
-  
-          target.z_point = extractFloat(data);
-          data += sizeof(float);
-
-          target.dop_index = extractFloat(data);
-          data += sizeof(float);
-  
-          
-  
-          received_targets.push_back(target); // Add the resolved target to the container
-        }
-  
-        // Store the received target data in the PeopleCounting object
-        _people_counting_target_info.targets = std::move(received_targets);
-        _isPeopleCountingTartgetInfoValid = true;
-  
-        break;
+      typedef mmWaveFallSchema<TypeFallDetection::Report3DPointCloudDetection>
+          Schema;
+      if (_lazy_decode) {
+        if (!_point_cloud_view.store(data, data_len))
+          return false;
+        // The recorder needs every cloud, the getter then takes this one
+        _point_cloud_decoded =
+            _fall_recorder &&
+            _point_cloud_view.decode(_people_counting_point_cloud.targets,
+                                     _roi, _rejected_points);
+      } else if (!Schema::decode(data, data_len,
+                                 _people_counting_point_cloud.targets, _roi,
+                                 _rejected_points)) {
+        return false;  // target count does not match the payload length
+      } else {
+        _point_cloud_decoded = true;
       }
+      if (_point_cloud_decoded && _clutter)
+        _clutter->filter(_people_counting_point_cloud);
+      _isPeopleCountingPointCloudValid = true;
+      if (_fall_recorder)
+        _fall_recorder->onPointCloud(millis(), _people_counting_point_cloud);
+      break;
+    }
+    case TypeFallDetection::Report3DPointCloudTartgetInfo: {
+      typedef mmWaveFallSchema<TypeFallDetection::Report3DPointCloudTartgetInfo>
+          Schema;
+      if (_lazy_decode ? !_target_info_view.store(data, data_len)
+                       : !Schema::decode(data, data_len,
+                                         _people_counting_target_info.targets))
+        return false;
+      _isPeopleCountingTartgetInfoValid = true;
+      break;
+    }
     default:
       return false;
   }
   return true;
 }
 
+/**
+ * @brief Get the newest point cloud, after the ROI and the clutter map.
+ *
+ * @attention With MMWAVE_STATIC_MEMORY the cloud is copied or decoded into
+ * `point_cloud`, which only stays off the heap if it was given its capacity
+ * once with mmWaveReserveCloud(). Keep it outside loop() for that.
+ *
+ * @param point_cloud Set to the cloud.
+ * @retval true A new cloud was received since the last call.
+ */
 bool SEEED_MR60FDA2::getPeopleCountingPointCloud(PeopleCounting& point_cloud) {
 
   if (!_isPeopleCountingPointCloudValid)
     return false;
   _isPeopleCountingPointCloudValid = false;
-  point_cloud = std::move(_people_counting_point_cloud);
+  if (!_point_cloud_decoded) {
+    if (!_point_cloud_view.decode(point_cloud.targets, _roi, _rejected_points))
+      return false;
+    if (_clutter)
+      _clutter->filter(point_cloud);
+    return true;
+  }
+  mmWaveTakeCloud(_people_counting_point_cloud, point_cloud);
   return true;
 }
 
+/**
+ * @brief Get the newest target info, see getPeopleCountingPointCloud() for
+ * MMWAVE_STATIC_MEMORY: reserve `target_info` with mmWaveReserveCloud().
+ */
 bool SEEED_MR60FDA2::getPeopleCountingTartgetInfo(PeopleCounting& target_info) {
   
   if (!_isPeopleCountingTartgetInfoValid)
     return false;
   _isPeopleCountingTartgetInfoValid = false;
-  target_info = std::move(_people_counting_target_info);
+  if (_lazy_decode)
+    return _target_info_view.decode(target_info.targets);
+  mmWaveTakeCloud(_people_counting_target_info, target_info);
+  return true;
+}
+
+/**
+ * @brief Keep point clouds as raw payloads and decode them on access.
+ *
+ * @attention When clouds arrive faster than they are read, most are never
+ * decoded: a received cloud only has its checksum and target count checked
+ * and its payload copied. getPeopleCountingPointCloud() then decodes the
+ * newest one, getPointCloudView() exposes it without decoding it at all.
+ * Clouds received before the mode changed are discarded.
+ *
+ * @param lazy true to decode on access, false to decode on reception.
+ */
+void SEEED_MR60FDA2::setLazyDecode(bool lazy) {
+  _lazy_decode                      = lazy;
+  _isPeopleCountingPointCloudValid  = false;
+  _isPeopleCountingTartgetInfoValid = false;
+}
+
+/**
+ * @brief Get the newest point cloud without decoding it, in lazy mode.
+ *
+ * @param view Set to the cloud, decode points with view->at(i) for
+ * i < view->size(). Valid until the next update() or fetch(). The view
+ * holds every point, view->decode(targets, getRoi(), rejected) applies the
+ * ROI.
+ * @retval true A new cloud was received since the last call.
+ * @retval false No new cloud, or setLazyDecode() is off.
+ */
+bool SEEED_MR60FDA2::getPointCloudView(const mmWaveFallCloudView*& view) {
+  if (!_lazy_decode || !_isPeopleCountingPointCloudValid)
+    return false;
+  _isPeopleCountingPointCloudValid = false;
+  view                             = &_point_cloud_view;
+  return true;
+}
+
+bool SEEED_MR60FDA2::getTargetInfoView(const mmWaveFallCloudView*& view) {
+  if (!_lazy_decode || !_isPeopleCountingTartgetInfoValid)
+    return false;
+  _isPeopleCountingTartgetInfoValid = false;
+  view                              = &_target_info_view;
   return true;
 }
 
@@ -411,6 +508,37 @@ bool SEEED_MR60FDA2::getPeopleCountingTartgetInfo(PeopleCounting& target_info) {
 
 
 
+/**
+ * @brief Remove static reflectors from the point clouds.
+ *
+ * @attention The map learns from every cloud it filters. Clouds are
+ * filtered on reception, before the fall recorder sees them, or in lazy
+ * mode when getPeopleCountingPointCloud() reads them; the views and the
+ * target info are not filtered.
+ *
+ * @param clutter The map, or nullptr to stop filtering.
+ */
+void SEEED_MR60FDA2::setClutterMap(mmWaveClutterMap* clutter) {
+  _clutter = clutter;
+}
+
+/**
+ * @brief Attach a fall event recorder.
+ *
+ * @param recorder The recorder fed with every decoded point cloud, presence
+ * and fall report, or nullptr to detach it.
+ *
+ * @note The recorder only sees point clouds while the user log is enabled,
+ * see setUserLog().
+ */
+void SEEED_MR60FDA2::setFallRecorder(mmWaveFallRecorder* recorder) {
+  _fall_recorder = recorder;
+  // The recorder keeps every frame of its history, do not coalesce them
+  setQueuePolicy(
+      static_cast<uint16_t>(TypeFallDetection::Report3DPointCloudDetection),
+      recorder ? mmWaveQueuePolicy::KeepAll : mmWaveQueuePolicy::LatestOnly);
+}
+
 bool SEEED_MR60FDA2::getFallInternal() {
   if (!_isFallValid)
     return false;
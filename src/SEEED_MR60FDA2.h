@@ -14,34 +14,16 @@
 
 #include "SeeedmmWave.h"
 #include "SEEED_Public.h"
-enum class TypeFallDetection : uint16_t {
-  UserLogInfo = 0x010E,
-
-  ReportFallDetection = 0x0E02,  // is_fall
-  InstallationHeight  = 0x0E04,
-  RadarParameters     = 0x0E06,
-  FallThreshold       = 0x0E08,
-  FallSensitivity     = 0x0E0A,
-
-  HeightUpload                  = 0x0E0E,
-  AlarmParameters               = 0x0E0C,
-  RadarInitSetting              = 0x2110,
-  Report3DPointCloudDetection   = 0x0A08,
-  Report3DPointCloudTartgetInfo = 0x0A04,
-  ReportUnmannedDetection       = 0x0F09,
-};
+#include "SeeedmmWaveClutter.h"
+#include "SeeedmmWaveFallRecorder.h"
+#include "SeeedmmWaveRoi.h"
+#include "SeeedmmWaveSchema.h"
 
 class SEEED_MR60FDA2 : public SeeedmmWave {
  private:
   /*  get parameters */
   bool _parametersValid = false; /* flag */
-  float _height;
-  float _thershold;  // deault value=0.6m
-  uint32_t _sensitivity;
-  float _rect_XL;
-  float _rect_XR;
-  float _rect_ZF;
-  float _rect_ZB;
+  FallRadarParameters _parameters;  // deault threshold=0.6m
 
 
 
@@ -64,16 +46,39 @@ class SEEED_MR60FDA2 : public SeeedmmWave {
 
   /* PeopleCounting PointCloud */
   PeopleCounting _people_counting_point_cloud;
-  bool _isPeopleCountingPointCloudValid;
+  bool _isPeopleCountingPointCloudValid = false;
  
   /* PeopleCounting TartgetInfo */
   PeopleCounting _people_counting_target_info;
-  bool _isPeopleCountingTartgetInfoValid;
+  bool _isPeopleCountingTartgetInfoValid = false;
+
+  /* Raw clouds kept by setLazyDecode() */
+  bool _lazy_decode         = false;
+  bool _point_cloud_decoded = false;  // in _people_counting_point_cloud too
+  mmWaveFallCloudView _point_cloud_view;
+  mmWaveFallCloudView _target_info_view;
+
+  /* Points outside it are dropped while the point cloud is decoded */
+  mmWaveRoiFilter _roi;
+  uint32_t _rejected_points = 0;
+
+  /* Static reflectors removed after decoding, optional */
+  mmWaveClutterMap* _clutter = nullptr;
+
+  /* Fall event recorder, optional */
+  mmWaveFallRecorder* _fall_recorder = nullptr;
  protected:
   bool getRadarParameters();
+  uint16_t probeType() const override;
 
  public:
-  SEEED_MR60FDA2() {}
+#if MMWAVE_STATIC_MEMORY
+  static constexpr size_t kReservedBytes =
+      2 * MMWAVE_MAX_POINTS * sizeof(TargetN) +
+      2 * mmWaveReservedBytes<mmWaveFallCloudView>::value;
+#endif
+
+  SEEED_MR60FDA2();
 
   virtual ~SEEED_MR60FDA2() {}
 
@@ -99,11 +104,30 @@ class SEEED_MR60FDA2 : public SeeedmmWave {
   // bool get3DPointCloud(const int option);
   bool getPeopleCountingPointCloud(PeopleCounting& point_cloud);
   bool getPeopleCountingTartgetInfo(PeopleCounting& target_info);
+
+  void setLazyDecode(bool lazy);
+  bool getPointCloudView(const mmWaveFallCloudView*& view);
+  bool getTargetInfoView(const mmWaveFallCloudView*& view);
+
+  void setRoi(const mmWaveRoiFilter& roi) {
+    _roi = roi;
+  }
+  const mmWaveRoiFilter& getRoi() const {
+    return _roi;
+  }
+  /* Points of the last decoded cloud that were outside the ROI */
+  uint32_t getRejectedPoints() const {
+    return _rejected_points;
+  }
+
+  void setClutterMap(mmWaveClutterMap* clutter);
   
   bool getFall(bool &is_fall);
   bool getHuman(bool &is_human);
   bool getFall();
   bool getHuman();
+
+  void setFallRecorder(mmWaveFallRecorder* recorder);
 };
 
 #endif /*SEEED_MR60FDA2_H*/
\ No newline at end of file
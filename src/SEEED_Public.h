@@ -1,7 +1,44 @@
 #ifndef SEEED_PUBLIC_H
 #define SEEED_PUBLIC_H
 
-#include "SeeedmmWave.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+enum class TypeFallDetection : uint16_t {
+  UserLogInfo = 0x010E,
+
+  ReportFallDetection = 0x0E02,  // is_fall
+  InstallationHeight  = 0x0E04,
+  RadarParameters     = 0x0E06,
+  FallThreshold       = 0x0E08,
+  FallSensitivity     = 0x0E0A,
+
+  HeightUpload                  = 0x0E0E,
+  AlarmParameters               = 0x0E0C,
+  RadarInitSetting              = 0x2110,
+  Report3DPointCloudDetection   = 0x0A08,
+  Report3DPointCloudTartgetInfo = 0x0A04,
+  ReportUnmannedDetection       = 0x0F09,
+};
+
+enum class TypeHeartBreath : uint16_t {
+  TypeHeartBreathPhase    = 0x0A13,
+  TypeBreathRate          = 0x0A14,
+  TypeHeartRate           = 0x0A15,
+  TypeHeartBreathDistance = 0x0A16,
+  Report3DPointCloudDetection   = 0x0A08,
+  Report3DPointCloudTartgetInfo = 0x0A04,
+  ReportHumanDetection       = 0x0F09,
+};
+
+typedef struct HeartBreath {
+  float total_phase;
+  float breath_phase;
+  float heart_phase;
+} HeartBreath;
+
 typedef struct TargetN {
   float x_point;
   float y_point;
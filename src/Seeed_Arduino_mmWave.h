@@ -16,6 +16,11 @@
 
 #include "SEEED_MR60BHA2.h"
 #include "SEEED_MR60FDA2.h"
+#include "SeeedmmWaveDevice.h"
+#include "SeeedmmWaveFusion.h"
+#include "SeeedmmWaveJson.h"
+#include "SeeedmmWaveStream.h"
+#include "SeeedmmWaveZones.h"
 
 typedef enum {
   MMWAVE_DEVICE_RESERVE = 0,
@@ -80,12 +80,7 @@ size_t SeeedmmWave::expectedFrameLength(const std::vector<uint8_t>& buffer) {
  * @return The calculated checksum.
  */
 uint8_t SeeedmmWave::calculateChecksum(const uint8_t* data, size_t len) {
-  uint8_t checksum = 0;
-  for (size_t i = 0; i < len; i++) {
-    checksum ^= data[i];
-  }
-  checksum = ~checksum;
-  return checksum;
+  return mmWaveChecksum(data, len);
 }
 
 /**
@@ -152,7 +147,7 @@ void SeeedmmWave::uint32ToBytes(uint32_t value, uint8_t* bytes) {
  * @return The extracted float value.
  */
 float SeeedmmWave::extractFloat(const uint8_t* bytes) const {
-  return *reinterpret_cast<const float*>(bytes);
+  return mmWaveLoadFloat(bytes);
 }
 
 /**
@@ -165,10 +160,17 @@ float SeeedmmWave::extractFloat(const uint8_t* bytes) const {
  * @return The extracted 32-bit unsigned integer.
  */
 uint32_t SeeedmmWave::extractU32(const uint8_t* bytes) const {
-  return *reinterpret_cast<const uint32_t*>(bytes);
+  return mmWaveLoadU32(bytes);
 }
-int32_t SeeedmmWave::extractI32(const uint8_t* bytes) const{
-  return *reinterpret_cast<const int32_t*>(bytes);
+
+/**
+ * @brief Extract a 32-bit signed integer from a byte array.
+ *
+ * @param bytes The byte array containing the 32-bit signed integer.
+ * @return The extracted 32-bit signed integer.
+ */
+int32_t SeeedmmWave::extractI32(const uint8_t* bytes) const {
+  return mmWaveLoadI32(bytes);
 }
 /**
  * @brief Initialize the SeeedmmWave object.
@@ -190,8 +192,12 @@ void SeeedmmWave::begin(HardwareSerial* serial, uint32_t baud,
 
   _serial->begin(_baud);
   _serial->setTimeout(1000);
-  _serial->setRxBufferSize(1024 * 32);
+  _serial->setRxBufferSize(MMWAVE_RX_BUFFER_SIZE);
   // _serial->setRxFIFOFull(20);
+  flushInput();  // also forgets which LatestOnly frames are queued
+  _sequence.restart();
+  _bringup = mmWaveBringUp::Idle;
+  _rst     = rst;
   if (rst >= 0) {
     pinMode(rst, OUTPUT);
     digitalWrite(rst, LOW);
@@ -201,6 +207,190 @@ void SeeedmmWave::begin(HardwareSerial* serial, uint32_t baud,
   }
 }
 
+/**
+ * @brief Start the sensor without blocking.
+ *
+ * @attention begin() waits a fixed 550 ms around the reset and every set*()
+ * call in setup() waits for its answer. beginAsync() returns at once and
+ * update() drives the bring-up from loop():
+ * - Reset: the reset pin, if any, is held low for MMWAVE_RESET_PULSE_MS.
+ * - Waiting: the first valid frame shows the module is up. probeType() is
+ *   sent every MMWAVE_PROBE_INTERVAL_MS meanwhile, so a module that
+ *   reports nothing by itself answers.
+ * - Configuring: the commands of queueConfig() are sent one at a time, each
+ *   waiting up to MMWAVE_COMMAND_TIMEOUT_MS for its answer.
+ * - Ready, or Failed if no frame came within `timeout`.
+ * The callback of setReadyCallback() is then called with the measured
+ * times. Frames received meanwhile are handled as usual.
+ *
+ * @param serial The serial port of the module.
+ * @param baud The baud rate.
+ * @param rst The reset pin. If negative, no reset is performed.
+ * @param timeout Time in milliseconds to wait for the first valid frame.
+ */
+void SeeedmmWave::beginAsync(HardwareSerial* serial, uint32_t baud, int rst,
+                             uint32_t timeout) {
+  this->_serial     = serial;
+  this->_baud       = baud;
+  this->_wait_delay = 1;
+
+  _serial->begin(_baud);
+  _serial->setTimeout(1000);
+  _serial->setRxBufferSize(MMWAVE_RX_BUFFER_SIZE);
+
+  _rst             = rst;
+  _bringup_timeout = timeout;
+  startBringUp();
+}
+
+/* Also the restart of the watchdog */
+void SeeedmmWave::startBringUp() {
+  flushInput();
+  _sequence.restart();  // a reset module numbers its frames afresh
+  _bringup_start  = millis();
+  _bringup_step   = _bringup_start;
+  _bringup_stats  = {};
+  _config_next    = 0;
+  _config_waiting = false;
+  if (_rst >= 0) {
+    pinMode(_rst, OUTPUT);
+    digitalWrite(_rst, LOW);
+    _bringup = mmWaveBringUp::Reset;
+  } else {
+    _bringup = mmWaveBringUp::Waiting;
+  }
+}
+
+/* Drop the received bytes, the partial frame and the queued frames */
+void SeeedmmWave::flushInput() {
+  for (int pending = _serial->available(); pending > 0; pending--) {
+    _serial->read();
+  }
+  _parser.reset();
+  _queue.clear();
+  for (uint8_t i = 0; i < _type_count; i++) {
+    _types[i].queued = false;
+  }
+}
+
+/**
+ * @brief Keep a command to send once beginAsync() has found the module.
+ *
+ * @attention The commands are sent in the order they were first queued; a
+ * command of a type already queued replaces its payload. They stay queued
+ * after the bring-up, so the next beginAsync() and a restart by the
+ * watchdog send them again. The set*() calls of the sensor classes keep
+ * their command this way, and while bringingUp() only queue it.
+ *
+ * @param type The frame type.
+ * @param data The payload.
+ * @param data_len Its length, at most MMWAVE_CONFIG_MAX_DATA.
+ * @param answered The module answers the command. If not, the next command
+ * follows without waiting.
+ * @retval true The command is queued.
+ * @retval false The payload is too long or MMWAVE_CONFIG_COMMANDS commands
+ * are already queued.
+ */
+bool SeeedmmWave::queueConfig(uint16_t type, const uint8_t* data,
+                              size_t data_len, bool answered) {
+  if (data_len > MMWAVE_CONFIG_MAX_DATA)
+    return false;
+  ConfigCommand* command = nullptr;
+  for (uint8_t i = 0; i < _config_count; i++) {
+    if (_config[i].type == type)
+      command = &_config[i];
+  }
+  if (!command) {
+    if (_config_count >= MMWAVE_CONFIG_COMMANDS)
+      return false;
+    command = &_config[_config_count++];
+  }
+  command->type     = type;
+  command->len      = data_len;
+  command->has_data = data != nullptr;
+  command->answered = answered;
+  if (data_len)
+    memcpy(command->data, data, data_len);
+  return true;
+}
+
+/* One step of the bring-up, called by update() */
+void SeeedmmWave::advanceBringUp() {
+  uint32_t now = millis();
+  switch (_bringup) {
+    case mmWaveBringUp::Reset:
+      if (now - _bringup_step < MMWAVE_RESET_PULSE_MS)
+        return;
+      digitalWrite(_rst, HIGH);
+      flushInput();  // whatever came before the reset is stale
+      _sequence.restart();
+      _bringup      = mmWaveBringUp::Waiting;
+      _bringup_step = now;
+      return;
+    case mmWaveBringUp::Waiting:
+      if (now - _bringup_start >= _bringup_timeout) {
+        finishBringUp(false);
+      } else if (probeType() != 0xFFFF &&
+                 now - _bringup_step >= MMWAVE_PROBE_INTERVAL_MS) {
+        send(probeType());
+        _bringup_step = now;
+      }
+      return;
+    case mmWaveBringUp::Configuring:
+      if (_config_waiting) {
+        if (now - _bringup_step < MMWAVE_COMMAND_TIMEOUT_MS)
+          return;
+        _bringup_stats.unanswered++;
+        _config_waiting = false;
+        _config_next++;
+      }
+      while (_config_next < _config_count) {
+        const ConfigCommand& command = _config[_config_next];
+        // send(type) adds no payload checksum, replay exactly that frame
+        send(command.type, command.has_data ? command.data : nullptr,
+             command.len);
+        _bringup_stats.commands++;
+        _bringup_step = now;
+        if (command.answered) {
+          _config_waiting = true;
+          return;
+        }
+        _config_next++;
+      }
+      finishBringUp(true);
+      return;
+    default:
+      return;
+  }
+}
+
+void SeeedmmWave::finishBringUp(bool ready) {
+  _bringup = ready ? mmWaveBringUp::Ready : mmWaveBringUp::Failed;
+  _bringup_stats.ready_ms = millis() - _bringup_start;
+  if (_watchdog.restarting())
+    _watchdog.restarted(ready, millis());  // reported as a watchdog event
+  else if (_ready_callback)
+    _ready_callback(ready, _bringup_stats, _ready_context);
+}
+
+/* One step of the watchdog, called by update() outside the bring-up */
+void SeeedmmWave::serviceWatchdog() {
+  uint16_t probe = probeType();
+  switch (_watchdog.poll(millis(), probe != 0xFFFF)) {
+    case mmWaveWatchdogAction::Probe:
+      send(probe);
+      break;
+    case mmWaveWatchdogAction::Flush:
+      flushInput();
+      break;
+    case mmWaveWatchdogAction::Restart:
+      startBringUp();
+      break;
+    default:
+      break;
+  }
+}
+
 /**
  * @brief Check the availability of data on the serial port.
  *
@@ -252,30 +442,39 @@ bool SeeedmmWave::processFrame(const uint8_t* frame_bytes, size_t len,
   if (len < SIZE_FRAME_HEADER)
     return false;  // Not enough data to process header
 
-  uint16_t id        = (frame_bytes[1] << 8) | frame_bytes[2];
-  uint16_t data_len  = (frame_bytes[3] << 8) | frame_bytes[4];
-  uint16_t type      = (frame_bytes[5] << 8) | frame_bytes[6];
-  uint8_t head_cksum = frame_bytes[7];
-  uint8_t data_cksum = frame_bytes[SIZE_FRAME_HEADER + data_len];
+  uint16_t data_len = mmWaveFrameDataLength(frame_bytes);
+  uint16_t type     = mmWaveFrameType(frame_bytes);
 
   // Only proceed if the type matches or if data_type is set to the default,
   // indicating no specific type is required
   if (data_type != 0xFFFF && data_type != type)
     return false;
-  // Checksum validation6
-  if (!validateChecksum(frame_bytes, SIZE_FRAME_HEADER - SIZE_DATA_CKSUM,
-                        head_cksum) ||
-      !validateChecksum(&frame_bytes[SIZE_FRAME_HEADER], data_len,
-                        data_cksum)) {
+  // Length and checksum validation
+  if (!mmWaveValidateFrame(frame_bytes, len)) {
     return false;
   }
 
-  return handleType(type, &frame_bytes[SIZE_FRAME_HEADER], data_len);
+  MMWAVE_TRACE_BEGIN(HandleType, type, data_len);
+  bool handled = handleType(type, &frame_bytes[SIZE_FRAME_HEADER], data_len);
+  MMWAVE_TRACE_END(HandleType, type, data_len);
+
+  // Any answer moves the bring-up on, a refused setting is not retried
+  if (handled && _config_waiting && type == _config[_config_next].type) {
+    _config_waiting = false;
+    _config_next++;
+  }
+  return handled;
+}
+
+/* Frame ids are shared by every sensor object, as before */
+static uint16_t nextFrameId() {
+  static uint16_t _id = 0x8000;
+  return _id++;
 }
 
 std::vector<uint8_t> SeeedmmWave::packetFrame(uint16_t type,
                                               const uint8_t* data, size_t len) {
-  static uint16_t _id = 0x8000;
+  uint16_t _id = nextFrameId();
   std::vector<uint8_t>
       frame;  // SOF, ID, LEN, TYPE, HEAD_CKSUM, DATA, DATA_CKSUM
 
@@ -297,19 +496,21 @@ std::vector<uint8_t> SeeedmmWave::packetFrame(uint16_t type,
     frame.push_back(data_cksum);  // Data checksum
   }
 
-  _id++;
   return frame;
 }
 
 bool SeeedmmWave::sendFrame(const std::vector<uint8_t>& frame) {
+  return sendBytes(frame.data(), frame.size());
+}
+
+bool SeeedmmWave::sendBytes(const uint8_t* data, size_t frameSize) {
 #if _MMWAVE_DEBUG == 1
   Serial.print("Send<<<");
-  printHexBuff(frame);
+  printHexBuff(std::vector<uint8_t>(data, data + frameSize));
 #endif
 
+  MMWAVE_TRACE_BEGIN(Send, mmWaveFrameType(data), frameSize);
   size_t totalBytesSent = 0;
-  size_t frameSize      = frame.size();
-  const uint8_t* data   = frame.data();
 
   while (totalBytesSent < frameSize) {
     size_t bytesToSend = frameSize - totalBytesSent;
@@ -327,6 +528,7 @@ bool SeeedmmWave::sendFrame(const std::vector<uint8_t>& frame) {
     _serial->flush();
   }
 
+  MMWAVE_TRACE_END(Send, mmWaveFrameType(data), totalBytesSent);
   return totalBytesSent == frameSize;
 }
 
@@ -342,77 +544,262 @@ bool SeeedmmWave::sendFrame(const std::vector<uint8_t>& frame) {
  * @return True if the frame is sent successfully, false otherwise.
  */
 bool SeeedmmWave::send(uint16_t type, const uint8_t* data, size_t data_len) {
+#if MMWAVE_STATIC_MEMORY
+  uint8_t frame[SIZE_FRAME_HEADER + MMWAVE_TX_MAX_DATA + SIZE_DATA_CKSUM];
+  if (data_len > MMWAVE_TX_MAX_DATA)
+    return false;
+  size_t size = mmWaveBuildFrame(frame, sizeof(frame), nextFrameId(), type,
+                                 data, data_len);
+  return sendBytes(frame, size);
+#else
   std::vector<uint8_t> frame = packetFrame(type, data, data_len);
   return sendFrame(frame);
+#endif
+}
+
+SeeedmmWave::TypeSlot* SeeedmmWave::findType(uint16_t type) {
+  for (uint8_t i = 0; i < _type_count; i++) {
+    if (_types[i].type == type)
+      return &_types[i];
+  }
+  return nullptr;
+}
+
+SeeedmmWave::TypeSlot* SeeedmmWave::addType(uint16_t type) {
+  TypeSlot* slot = findType(type);
+  if (slot || _type_count >= MMWAVE_TYPE_SLOTS)
+    return slot;
+  slot           = &_types[_type_count++];
+  slot->type     = type;
+  slot->priority = mmWavePriority::State;
+  slot->policy   = mmWaveQueuePolicy::KeepAll;
+  slot->queued   = false;
+  slot->seq      = 0;
+  return slot;
+}
+
+/**
+ * @brief Select how queued frames of one type are handled.
+ *
+ * @attention With mmWaveQueuePolicy::LatestOnly a frame that arrives while
+ * an older frame of the same type is still queued overwrites that frame in
+ * place, so after a stall only the newest report of each such type is
+ * handled. Use it for state reports whose getters return the last value.
+ *
+ * @param type The frame type.
+ * @param policy The queue policy, KeepAll by default.
+ * @retval true The policy is set.
+ * @retval false MMWAVE_TYPE_SLOTS types are already configured.
+ */
+bool SeeedmmWave::setQueuePolicy(uint16_t type, mmWaveQueuePolicy policy) {
+  TypeSlot* slot = addType(type);
+  if (!slot)
+    return false;
+  slot->policy = policy;
+  slot->queued = false;
+  return true;
+}
+
+mmWaveQueuePolicy SeeedmmWave::getQueuePolicy(uint16_t type) {
+  TypeSlot* slot = findType(type);
+  return slot ? slot->policy : mmWaveQueuePolicy::KeepAll;
+}
+
+/**
+ * @brief Select the lane frames of one type are queued in.
+ *
+ * @attention processQueuedFrames() drains the lanes in mmWavePriority
+ * order, so an alarm never waits behind queued point clouds.
+ *
+ * @param type The frame type.
+ * @param priority The lane, mmWavePriority::State by default.
+ * @retval true The priority is set.
+ * @retval false MMWAVE_TYPE_SLOTS types are already configured.
+ */
+bool SeeedmmWave::setFramePriority(uint16_t type, mmWavePriority priority) {
+  TypeSlot* slot = addType(type);
+  if (!slot)
+    return false;
+  slot->priority = priority;
+  slot->queued   = false;
+  return true;
+}
+
+mmWavePriority SeeedmmWave::getFramePriority(uint16_t type) {
+  TypeSlot* slot = findType(type);
+  return slot ? slot->priority : mmWavePriority::State;
+}
+
+void SeeedmmWave::enqueueFrame(const uint8_t* frame, size_t len) {
+  TypeSlot* slot = findType(mmWaveFrameType(frame));
+  uint8_t lane   = static_cast<uint8_t>(slot ? slot->priority
+                                             : mmWavePriority::State);
+
+  // Acknowledgements carry the id of the command they answer
+  if (lane != static_cast<uint8_t>(mmWavePriority::CommandAck))
+    _sequence.observe(mmWaveFrameType(frame), mmWaveFrameId(frame));
+
+  bool latest = slot && slot->policy == mmWaveQueuePolicy::LatestOnly;
+  if (latest && slot->queued && _queue.replace(lane, slot->seq, frame, len)) {
+    _coalesced++;
+    return;
+  }
+
+  if (_queue.push(lane, frame, len) && latest) {
+    slot->seq    = _queue.lastSeq(lane);
+    slot->queued = true;
+  }
+}
+
+/**
+ * @brief Feed received bytes to the frame parser and queue complete frames.
+ *
+ * @attention fetch() and bridge() use it for the bytes they read; call it
+ * directly to decode a stream that does not come from the serial port.
+ *
+ * @param data The received bytes.
+ * @param len The number of bytes.
+ */
+void SeeedmmWave::ingest(const uint8_t* data, size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    if (!_parser.push(data[i]))
+      continue;
+
+#if _MMWAVE_DEBUG == 1
+    printHexBuff(std::vector<uint8_t>(_parser.frame(),
+                                      _parser.frame() + _parser.length()));
+#endif
+    MMWAVE_TRACE_INSTANT(FrameReceived, mmWaveFrameType(_parser.frame()),
+                         _parser.length());
+    if (_bringup == mmWaveBringUp::Waiting) {
+      _bringup_stats.first_frame_ms = millis() - _bringup_start;
+      _bringup                      = mmWaveBringUp::Configuring;
+    }
+    if (_watchdog.enabled())
+      _watchdog.observe(mmWaveFrameType(_parser.frame()), millis());
+    enqueueFrame(_parser.frame(), _parser.length());
+  }
+}
+
+/* Read what the sensor has sent, without waiting for more */
+size_t SeeedmmWave::readBlock(uint8_t* block, size_t capacity) {
+  int available = _serial->available();
+  if (available <= 0)
+    return 0;
+  size_t len = static_cast<size_t>(available) < capacity ? available : capacity;
+  return _serial->readBytes(block, len);
 }
 
 void SeeedmmWave::fetch(uint32_t timeout) {
-  static bool startFrame = false;
-  static std::vector<uint8_t> frameBuffer;
+  uint8_t block[MMWAVE_IO_BLOCK_SIZE];
   uint32_t expire_time = millis() + timeout;
-  uint8_t frameDataSize;
+  size_t fetched       = 0;
+  MMWAVE_TRACE_BEGIN(Fetch, 0xFFFF, 0);
   do {
-    size_t c_available = _serial->available();
-    while (c_available--) {
-      uint8_t byte = _serial->read();
-      if (startFrame)  // Frame processing
-      {
-        frameBuffer.push_back(byte);
-        // Serial.print("Read byte: ");
-        // Serial.println(byte, HEX);
-        if (frameBuffer.size() >= SIZE_FRAME_HEADER)  // right package
-        {
-          frameDataSize = (frameBuffer[3] << 8 | frameBuffer[4]);
-          if (frameDataSize > 1024) {
-            startFrame = false;
-            // Serial.println("FrameDataSize too large, clearing buffer");
-            continue;
-          }
-          if (frameBuffer.size() ==
-              (SIZE_FRAME_HEADER + frameDataSize + SIZE_DATA_CKSUM)) {
-            if (byteQueue.size() >= MMWaveMaxQueueSize) {
-              byteQueue.pop();  // Discard the oldest frame
-              // Serial.println("Queue full, discarding oldest frame");
-            }
-#if _MMWAVE_DEBUG == 1
-            printHexBuff(frameBuffer);
-#endif
-            byteQueue.push(frameBuffer);  // Add the complete frame to the queue
-            startFrame = false;
-          }
-        }
-      } else {
-        if (byte == SOF_BYTE) {  // Start of frame
-          startFrame = true;
-          frameBuffer.clear();
-          frameBuffer.push_back(byte);  // insert 0x01
-          // Serial.println("Start of Frame detected 0x01");
-        }
-      }
+    // Only what is there now, a fast sender must not hold us past the timeout
+    int pending = _serial->available();
+    while (pending > 0) {
+      size_t len = readBlock(block, static_cast<size_t>(pending) < sizeof(block)
+                                        ? static_cast<size_t>(pending)
+                                        : sizeof(block));
+      if (len == 0)
+        break;
+      ingest(block, len);
+      pending -= len;
+      fetched += len;
     }
   } while (millis() < expire_time);
+  MMWAVE_TRACE_END(Fetch, 0xFFFF, fetched);
+  (void)fetched;
 }
 
-bool SeeedmmWave::processQueuedFrames(uint16_t data_type, uint32_t timeout) {
-  bool result = false;
+/**
+ * @brief Forward bytes between the sensor and a host, e.g. the vendor GUI.
+ *
+ * @attention Call it from loop(). Each pass moves up to
+ * MMWAVE_IO_BLOCK_SIZE bytes in each direction and never more than the
+ * receiving side can take without blocking; the rest waits in the receive
+ * buffers, MMWAVE_RX_BUFFER_SIZE bytes on the sensor side. With `tap` the
+ * bytes from the sensor are also queued as frames, so fall and presence
+ * reports can be handled with processQueuedFrames() while the host is
+ * connected. Frames sent by the host are not parsed.
+ *
+ * @param host The stream the host is connected to.
+ * @param tap Also feed the sensor bytes to the frame parser.
+ * @return The number of bytes moved in both directions.
+ */
+size_t SeeedmmWave::bridge(Stream& host, bool tap) {
+  if (!_serial)
+    return 0;
+  uint8_t block[MMWAVE_IO_BLOCK_SIZE];
+  size_t moved = 0;
+
+  int room = host.availableForWrite();
+  if (room > 0) {
+    size_t len = readBlock(block, static_cast<size_t>(room) < sizeof(block)
+                                      ? static_cast<size_t>(room)
+                                      : sizeof(block));
+    if (len > 0) {
+      size_t written = host.write(block, len);
+      if (tap)
+        ingest(block, len);
+      _bridged_to_host += written;
+      _bridge_dropped += len - written;
+      moved += len;
+    }
+  }
 
-  if (byteQueue.empty()) {
-    return false;
+  int pending = host.available();
+  room        = _serial->availableForWrite();
+  if (pending > 0 && room > 0) {
+    size_t len = sizeof(block);
+    if (static_cast<size_t>(pending) < len)
+      len = pending;
+    if (static_cast<size_t>(room) < len)
+      len = room;
+    len = host.readBytes(block, len);
+    if (len > 0) {
+      size_t written = _serial->write(block, len);
+      _bridged_to_sensor += written;
+      _bridge_dropped += len - written;
+      moved += len;
+    }
   }
+  return moved;
+}
 
-  uint32_t expire_time = millis() + timeout;
+/**
+ * @brief Handle queued frames, highest priority lane first.
+ *
+ * @param data_type Only handle frames of this type, others are discarded.
+ * Defaults to 0xFFFF, any type.
+ * @param timeout Time budget in milliseconds. At least one frame is handled
+ * per call; frames left when the budget is spent stay queued.
+ * @return true if at least one frame was handled.
+ */
+bool SeeedmmWave::processQueuedFrames(uint16_t data_type, uint32_t timeout) {
+  bool result    = false;
+  uint32_t start = millis();
+
+  uint8_t lane = 0;
   do {
-    std::vector<uint8_t> frame = byteQueue.front();
-    byteQueue.pop();
+    while (lane < MMWAVE_LANE_COUNT && _queue.size(lane) == 0) {
+      lane++;
+    }
+    if (lane == MMWAVE_LANE_COUNT)
+      break;
+
+    size_t len;
+    const uint8_t* frame = _queue.front(lane, len);
 #if _MMWAVE_DEBUG == 1
-    printHexBuff(frame);  // Print received bytes
+    printHexBuff(std::vector<uint8_t>(frame, frame + len));
 #endif
-    if (!this->processFrame(frame.data(), frame.size(), data_type)) {
-      continue;
-    } else {
+    MMWAVE_TRACE_BEGIN(ProcessFrame, mmWaveFrameType(frame), len);
+    if (this->processFrame(frame, len, data_type))
       result = true;
-    }
-  } while (!byteQueue.empty() && timeout);
+    MMWAVE_TRACE_END(ProcessFrame, mmWaveFrameType(frame), len);
+    _queue.pop(lane);
+  } while (millis() - start < timeout);
 
   return result;
 }
@@ -425,11 +812,21 @@ bool SeeedmmWave::processQueuedFrames(uint16_t data_type, uint32_t timeout) {
  * @return false
  */
 bool SeeedmmWave::update(uint32_t timeout) {
+  MMWAVE_TRACE_BEGIN(Update, 0xFFFF, 0);
   this->fetch(timeout);
-  return processQueuedFrames(0xFFFF, timeout);
+  bool result = processQueuedFrames(0xFFFF, timeout);
+  if (bringingUp())
+    advanceBringUp();
+  else if (_watchdog.enabled())
+    serviceWatchdog();
+  MMWAVE_TRACE_END(Update, 0xFFFF, 0);
+  return result;
 }
 
 bool SeeedmmWave::fetchType(uint16_t data_type, uint32_t timeout) {
+  MMWAVE_TRACE_BEGIN(Command, data_type, 0);
   this->fetch(timeout);
-  return processQueuedFrames(data_type);
+  bool result = processQueuedFrames(data_type);
+  MMWAVE_TRACE_END(Command, data_type, result);
+  return result;
 }
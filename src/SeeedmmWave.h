@@ -19,7 +19,13 @@
 #endif
 
 #include <memory>
-#include <queue>
+#include <vector>
+
+#include "SeeedmmWaveFrame.h"
+#include "SeeedmmWaveQueue.h"
+#include "SeeedmmWaveSequence.h"
+#include "SeeedmmWaveTrace.h"
+#include "SeeedmmWaveWatchdog.h"
 
 #define _MMWAVE_DEBUG 0
 
@@ -29,41 +35,144 @@
 #  warning "Notice: the uart baud of mmWave serial should be 115200"
 #endif
 
-#define MAX_QUEUE_SIZE    10
-#define FRAME_BUFFER_SIZE 512
-#define SOF_BYTE          0x01
-
-// Frame structure sizes
-#define SIZE_SOF        1
-#define SIZE_ID         2
-#define SIZE_LEN        2
-#define SIZE_TYPE       2
-#define SIZE_HEAD_CKSUM 1
-#define SIZE_FRAME_HEADER                                                      \
-  (SIZE_SOF + SIZE_ID + SIZE_LEN + SIZE_TYPE + SIZE_HEAD_CKSUM)
-#define SIZE_DATA_CKSUM 1
-
-#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
-#  define SEEED_WAVE_IS_BIG_ENDIAN 1
-#elif defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
-#  define SEEED_WAVE_IS_BIG_ENDIAN 0
-#else
-#  warning "Unable to determine the size end system"
+/* UART driver receive buffer, allocated by begin() */
+#ifndef MMWAVE_RX_BUFFER_SIZE
+#  define MMWAVE_RX_BUFFER_SIZE (1024 * 32)
 #endif
 
-#ifndef ESP32
+/* Largest command payload send() accepts with MMWAVE_STATIC_MEMORY */
+#ifndef MMWAVE_TX_MAX_DATA
+#  define MMWAVE_TX_MAX_DATA 64
+#endif
+
+/* Bytes moved per read by fetch(), and per direction and pass by bridge() */
+#ifndef MMWAVE_IO_BLOCK_SIZE
+#  define MMWAVE_IO_BLOCK_SIZE 256
+#endif
+
+/* Not used by the library, the effective limits are the lane sizes and
+ * MMWAVE_MAX_FRAME_SIZE. Kept for sketches that refer to them. */
+#define MAX_QUEUE_SIZE    MMWaveMaxQueueSize
+#define FRAME_BUFFER_SIZE MMWAVE_MAX_FRAME_SIZE
+
+/* Frame types with a policy or priority other than the default */
+#ifndef MMWAVE_TYPE_SLOTS
+#  define MMWAVE_TYPE_SLOTS 12
+#endif
+
+/* Configuration commands kept for beginAsync(), and their largest payload */
+#ifndef MMWAVE_CONFIG_COMMANDS
+#  define MMWAVE_CONFIG_COMMANDS 6
+#endif
+#ifndef MMWAVE_CONFIG_MAX_DATA
+#  define MMWAVE_CONFIG_MAX_DATA 16
+#endif
 
+/* Bring-up timing of beginAsync(), in milliseconds */
+#ifndef MMWAVE_RESET_PULSE_MS
+#  define MMWAVE_RESET_PULSE_MS 50
+#endif
+#ifndef MMWAVE_PROBE_INTERVAL_MS
+#  define MMWAVE_PROBE_INTERVAL_MS 250
+#endif
+#ifndef MMWAVE_COMMAND_TIMEOUT_MS
+#  define MMWAVE_COMMAND_TIMEOUT_MS 1000
+#endif
+#ifndef MMWAVE_BRINGUP_TIMEOUT_MS
+#  define MMWAVE_BRINGUP_TIMEOUT_MS 5000
 #endif
 
-#define MMWaveMaxQueueSize 2048
+enum class mmWaveQueuePolicy : uint8_t {
+  KeepAll,     // every frame is handled in order, e.g. fall and presence
+  LatestOnly,  // a newer frame replaces the queued one, e.g. point clouds
+};
+
+/* Priority lanes, drained in this order */
+enum class mmWavePriority : uint8_t {
+  Alarm,       // fall and presence events
+  CommandAck,  // responses to send()
+  State,       // small periodic reports, the default
+  Bulk,        // point clouds
+};
+
+enum class mmWaveBringUp : uint8_t {
+  Idle,         // begin() was used, or nothing was started
+  Reset,        // the reset pin is held low
+  Waiting,      // for the first valid frame from the module
+  Configuring,  // sending the commands queued with queueConfig()
+  Ready,        // the module answered and was configured
+  Failed,       // no valid frame before the timeout
+};
+
+typedef struct mmWaveBringUpStats {
+  uint32_t first_frame_ms;  // from beginAsync() to the first valid frame
+  uint32_t ready_ms;        // to Ready or Failed, configuration included
+  uint8_t commands;         // configuration commands sent
+  uint8_t unanswered;       // of those, commands that timed out
+} mmWaveBringUpStats;
+
+/* Called once the bring-up started by beginAsync() ends */
+typedef void (*mmWaveReadyCallback)(bool ready,
+                                    const mmWaveBringUpStats& stats,
+                                    void* context);
 
 class SeeedmmWave {
  private:
-  HardwareSerial* _serial;
+  HardwareSerial* _serial = nullptr;
   uint32_t _baud;
   uint32_t _wait_delay;
 
-  std::queue<std::vector<uint8_t>> byteQueue;
+  mmWaveFrameParser _parser;
+  mmWaveFrameQueue _queue;
+  mmWaveSequenceTracker _sequence;
+  mmWaveLinkWatchdog _watchdog;
+
+  struct TypeSlot {
+    uint16_t type;
+    mmWavePriority priority;
+    mmWaveQueuePolicy policy;
+    bool queued;   // a LatestOnly frame of this type is in its lane
+    uint32_t seq;  // and this is its sequence number
+  };
+  TypeSlot _types[MMWAVE_TYPE_SLOTS];
+  uint8_t _type_count = 0;
+  uint32_t _coalesced = 0;
+
+  uint32_t _bridged_to_host   = 0;
+  uint32_t _bridged_to_sensor = 0;
+  uint32_t _bridge_dropped    = 0;
+
+  struct ConfigCommand {
+    uint16_t type;
+    uint8_t len;
+    bool has_data;  // sent with a payload checksum, even if len is 0
+    bool answered;  // the module answers it
+    uint8_t data[MMWAVE_CONFIG_MAX_DATA];
+  };
+  ConfigCommand _config[MMWAVE_CONFIG_COMMANDS];
+  uint8_t _config_count = 0;
+  uint8_t _config_next  = 0;      // next command to send while Configuring
+  bool _config_waiting  = false;  // for the answer to _config[_config_next]
+
+  mmWaveBringUp _bringup              = mmWaveBringUp::Idle;
+  int _rst                            = -1;
+  uint32_t _bringup_start             = 0;
+  uint32_t _bringup_step              = 0;  // last reset, probe or command
+  uint32_t _bringup_timeout           = MMWAVE_BRINGUP_TIMEOUT_MS;
+  mmWaveBringUpStats _bringup_stats   = {};
+  mmWaveReadyCallback _ready_callback = nullptr;
+  void* _ready_context                = nullptr;
+
+  void startBringUp();
+  void advanceBringUp();
+  void finishBringUp(bool ready);
+  void flushInput();
+  void serviceWatchdog();
+
+  TypeSlot* findType(uint16_t type);
+  TypeSlot* addType(uint16_t type);
+  void enqueueFrame(const uint8_t* frame, size_t len);
+  size_t readBlock(uint8_t* block, size_t capacity);
 
  protected:
   size_t expectedFrameLength(const std::vector<uint8_t>& buffer);
@@ -93,9 +202,20 @@ class SeeedmmWave {
   virtual bool handleType(uint16_t _type, const uint8_t* data,
                           size_t data_len) = 0;
 
+  /**
+   * @brief Frame type sent while beginAsync() waits for the module, to get
+   * an answer from a module that reports nothing by itself.
+   *
+   * @return 0xFFFF, the default, to send nothing.
+   */
+  virtual uint16_t probeType() const {
+    return 0xFFFF;
+  }
+
   std::vector<uint8_t> packetFrame(uint16_t type, const uint8_t* data = nullptr,
                                    size_t len = 0);
   bool sendFrame(const std::vector<uint8_t>& frame);
+  bool sendBytes(const uint8_t* frame, size_t len);
 
  public:
   SeeedmmWave() {}
@@ -108,6 +228,60 @@ class SeeedmmWave {
 
   void begin(HardwareSerial* serial, uint32_t baud = _UART_BAUD,
              uint32_t wait_delay = 1, int rst = -1);
+  void beginAsync(HardwareSerial* serial, uint32_t baud = _UART_BAUD,
+                  int rst = -1, uint32_t timeout = MMWAVE_BRINGUP_TIMEOUT_MS);
+  mmWaveBringUp bringUpState() const {
+    return _bringup;
+  }
+  /* beginAsync() has not ended yet, commands are queued and not sent */
+  bool bringingUp() const {
+    return _bringup == mmWaveBringUp::Reset ||
+           _bringup == mmWaveBringUp::Waiting ||
+           _bringup == mmWaveBringUp::Configuring;
+  }
+  bool ready() const {
+    return _bringup == mmWaveBringUp::Ready;
+  }
+  const mmWaveBringUpStats& bringUpStats() const {
+    return _bringup_stats;
+  }
+  void setReadyCallback(mmWaveReadyCallback callback,
+                        void* context = nullptr) {
+    _ready_callback = callback;
+    _ready_context  = context;
+  }
+
+  bool queueConfig(uint16_t type, const uint8_t* data = nullptr,
+                   size_t data_len = 0, bool answered = true);
+  void clearConfig() {
+    _config_count   = 0;
+    _config_next    = 0;
+    _config_waiting = false;
+  }
+  size_t configCommands() const {
+    return _config_count;
+  }
+
+  /* Stall detection and recovery, see SeeedmmWaveWatchdog.h. update()
+   * drives it. */
+  bool setWatchdog(uint32_t timeout_ms) {
+    return _watchdog.watch(MMWAVE_WATCH_LINK, timeout_ms, millis());
+  }
+  bool watchStream(uint16_t type, uint32_t timeout_ms) {
+    return _watchdog.watch(type, timeout_ms, millis());
+  }
+  void setWatchdogCallback(mmWaveWatchdogCallback callback,
+                           void* context = nullptr) {
+    _watchdog.setCallback(callback, context);
+  }
+  const mmWaveWatchdogStats& watchdogStats() const {
+    return _watchdog.stats();
+  }
+  /* Time since the last frame of a watched stream */
+  uint32_t silentMs(uint16_t type = MMWAVE_WATCH_LINK) const {
+    return _watchdog.silentMs(type, millis());
+  }
+
   int available();
   int read(void);
   int read(char* data, int length);
@@ -131,9 +305,55 @@ class SeeedmmWave {
   bool fetchType(uint16_t data_type = 0xFFFF, uint32_t timeout = 1000);
   bool send(uint16_t type, const uint8_t* data = nullptr, size_t data_len = 0);
 
+  void ingest(const uint8_t* data, size_t len);
+  size_t bridge(Stream& host, bool tap = true);
+
   bool processQueuedFrames(uint16_t data_type = 0xFFFF,
                            uint32_t timeout   = 1000);
 
+  bool setQueuePolicy(uint16_t type, mmWaveQueuePolicy policy);
+  mmWaveQueuePolicy getQueuePolicy(uint16_t type);
+  bool setFramePriority(uint16_t type, mmWavePriority priority);
+  mmWavePriority getFramePriority(uint16_t type);
+
+  size_t queuedFrames() const {
+    return _queue.size();
+  }
+  size_t queuedFrames(mmWavePriority priority) const {
+    return _queue.size(static_cast<uint8_t>(priority));
+  }
+  uint32_t droppedFrames(mmWavePriority priority) const {
+    return _queue.dropped(static_cast<uint8_t>(priority));
+  }
+  uint32_t coalescedFrames() const {
+    return _coalesced;
+  }
+
+  /* Bytes forwarded by bridge() in each direction, and lost because the
+   * receiving side accepted fewer bytes than it announced */
+  uint32_t bridgedToHost() const {
+    return _bridged_to_host;
+  }
+  uint32_t bridgedToSensor() const {
+    return _bridged_to_sensor;
+  }
+  uint32_t bridgeDroppedBytes() const {
+    return _bridge_dropped;
+  }
+
+  /* Gaps in the ids of received frames, before they are queued. Frames
+   * dropped or coalesced by the queue are counted by droppedFrames() and
+   * coalescedFrames(), acknowledgements in the CommandAck lane are not
+   * tracked. */
+  void setSequenceScope(mmWaveSequenceScope scope) {
+    _sequence.setScope(scope);
+  }
+  void setLossCallback(mmWaveLossCallback callback, void* context = nullptr) {
+    _sequence.setLossCallback(callback, context);
+  }
+  const mmWaveSequenceStats& sequenceStats() const {
+    return _sequence.stats();
+  }
 };
 
 void printHexBuff(const std::vector<uint8_t>& buffer);
@@ -0,0 +1,167 @@
+/**
+ * @file SeeedmmWaveBatch.cpp
+ * @date  18 October 2026
+ *
+ * @note Batch decode of fixed-stride payload records into column arrays.
+ *
+ * @copyright © 2024, Seeed Studio
+ */
+
+#include "SeeedmmWaveBatch.h"
+
+/* Vector loads reinterpret the payload as little-endian lanes */
+#if !defined(MMWAVE_BATCH_SCALAR) && SEEED_WAVE_IS_BIG_ENDIAN == 0
+#  if defined(__SSE2__)
+#    include <emmintrin.h>
+#    define MMWAVE_BATCH_SSE2 1
+#  elif defined(__ARM_NEON)
+#    include <arm_neon.h>
+#    define MMWAVE_BATCH_NEON 1
+#  endif
+#  if defined(__AVX2__)
+#    include <immintrin.h>
+#    define MMWAVE_BATCH_AVX2 1
+#  endif
+#endif
+
+static inline void storeU32(uint8_t* column, size_t index, uint32_t value) {
+  memcpy(column + index * sizeof(uint32_t), &value, sizeof(value));
+}
+
+/* One field of records [first, count) */
+static void loadColumnScalar(const uint8_t* data, size_t stride, size_t first,
+                             size_t count, size_t offset, uint8_t* column) {
+  const uint8_t* p = data + first * stride + offset;
+  for (size_t i = first; i < count; i++, p += stride) {
+    storeU32(column, i, mmWaveLoadU32(p));
+  }
+}
+
+#if defined(MMWAVE_BATCH_AVX2)
+/* One field of eight records per gather, returns the records done */
+static size_t loadColumnAvx2(const uint8_t* data, size_t stride, size_t count,
+                             size_t offset, uint8_t* column) {
+  if (stride > 0x7FFFFFFF / 8)
+    return 0;
+
+  const int s         = static_cast<int>(stride);
+  const __m256i index = _mm256_setr_epi32(0, s, 2 * s, 3 * s, 4 * s, 5 * s,
+                                          6 * s, 7 * s);
+  const uint8_t* p    = data + offset;
+  size_t i            = 0;
+  for (; i + 8 <= count; i += 8, p += 8 * stride) {
+    __m256i lanes =
+        _mm256_i32gather_epi32(reinterpret_cast<const int*>(p), index, 1);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(column + i * 4), lanes);
+  }
+  return i;
+}
+#endif
+
+/* Four adjacent fields, four records per 4x4 transpose on hosts */
+static void loadQuad(const uint8_t* data, size_t stride, size_t count,
+                     size_t offset, uint8_t* const* columns) {
+  const uint8_t* p = data + offset;
+  size_t i         = 0;
+#if defined(MMWAVE_BATCH_SSE2)
+  for (; i + 4 <= count; i += 4, p += 4 * stride) {
+    __m128i r0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    __m128i r1 =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + stride));
+    __m128i r2 =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 2 * stride));
+    __m128i r3 =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 3 * stride));
+
+    __m128i t0 = _mm_unpacklo_epi32(r0, r1);
+    __m128i t1 = _mm_unpacklo_epi32(r2, r3);
+    __m128i t2 = _mm_unpackhi_epi32(r0, r1);
+    __m128i t3 = _mm_unpackhi_epi32(r2, r3);
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(columns[0] + i * 4),
+                     _mm_unpacklo_epi64(t0, t1));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(columns[1] + i * 4),
+                     _mm_unpackhi_epi64(t0, t1));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(columns[2] + i * 4),
+                     _mm_unpacklo_epi64(t2, t3));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(columns[3] + i * 4),
+                     _mm_unpackhi_epi64(t2, t3));
+  }
+#elif defined(MMWAVE_BATCH_NEON)
+  for (; i + 4 <= count; i += 4, p += 4 * stride) {
+    uint32x4_t r0 = vreinterpretq_u32_u8(vld1q_u8(p));
+    uint32x4_t r1 = vreinterpretq_u32_u8(vld1q_u8(p + stride));
+    uint32x4_t r2 = vreinterpretq_u32_u8(vld1q_u8(p + 2 * stride));
+    uint32x4_t r3 = vreinterpretq_u32_u8(vld1q_u8(p + 3 * stride));
+
+    uint32x4x2_t t01 = vtrnq_u32(r0, r1);
+    uint32x4x2_t t23 = vtrnq_u32(r2, r3);
+
+    vst1q_u8(columns[0] + i * 4,
+             vreinterpretq_u8_u32(vcombine_u32(vget_low_u32(t01.val[0]),
+                                               vget_low_u32(t23.val[0]))));
+    vst1q_u8(columns[1] + i * 4,
+             vreinterpretq_u8_u32(vcombine_u32(vget_low_u32(t01.val[1]),
+                                               vget_low_u32(t23.val[1]))));
+    vst1q_u8(columns[2] + i * 4,
+             vreinterpretq_u8_u32(vcombine_u32(vget_high_u32(t01.val[0]),
+                                               vget_high_u32(t23.val[0]))));
+    vst1q_u8(columns[3] + i * 4,
+             vreinterpretq_u8_u32(vcombine_u32(vget_high_u32(t01.val[1]),
+                                               vget_high_u32(t23.val[1]))));
+  }
+#endif
+  for (; i < count; i++, p += stride) {
+    storeU32(columns[0], i, mmWaveLoadU32(p));
+    storeU32(columns[1], i, mmWaveLoadU32(p + 4));
+    storeU32(columns[2], i, mmWaveLoadU32(p + 8));
+    storeU32(columns[3], i, mmWaveLoadU32(p + 12));
+  }
+}
+
+bool mmWaveBatchLoad32(const uint8_t* data, size_t data_len, size_t stride,
+                       size_t count, const uint8_t* offsets, size_t num_fields,
+                       void* const* columns) {
+  if (count == 0)
+    return true;
+  if (stride == 0 || count > data_len / stride)
+    return false;
+  for (size_t f = 0; f < num_fields; f++) {
+    if (offsets[f] + sizeof(uint32_t) > stride)
+      return false;
+  }
+
+  size_t f = 0;
+  while (f < num_fields) {
+    uint8_t* column = static_cast<uint8_t*>(columns[f]);
+    if (f + 4 <= num_fields && offsets[f + 1] == offsets[f] + 4 &&
+        offsets[f + 2] == offsets[f] + 8 && offsets[f + 3] == offsets[f] + 12) {
+      uint8_t* quad[4] = {column, static_cast<uint8_t*>(columns[f + 1]),
+                          static_cast<uint8_t*>(columns[f + 2]),
+                          static_cast<uint8_t*>(columns[f + 3])};
+      loadQuad(data, stride, count, offsets[f], quad);
+      f += 4;
+      continue;
+    }
+
+    size_t done = 0;
+#if defined(MMWAVE_BATCH_AVX2)
+    done = loadColumnAvx2(data, stride, count, offsets[f], column);
+#endif
+    loadColumnScalar(data, stride, done, count, offsets[f], column);
+    f++;
+  }
+  return true;
+}
+
+const char* mmWaveBatchKernel() {
+#if defined(MMWAVE_BATCH_AVX2)
+  return "avx2";
+#elif defined(MMWAVE_BATCH_SSE2)
+  return "sse2";
+#elif defined(MMWAVE_BATCH_NEON)
+  return "neon";
+#else
+  return "scalar";
+#endif
+}
@@ -0,0 +1,47 @@
+/**
+ * @file SeeedmmWaveBatch.h
+ * @date  18 October 2026
+ *
+ * @note Batch decode of fixed-stride payload records into column arrays.
+ *
+ * @copyright © 2024, Seeed Studio
+ *
+ * @attention The kernel copies 32-bit little-endian fields out of `count`
+ * records in one pass, one output array per field. It never dereferences a
+ * misaligned pointer: MCUs use memcpy loads (byte swapped on big-endian
+ * targets), hosts use SSE2/AVX2 or NEON when the compiler enables them.
+ * Define MMWAVE_BATCH_SCALAR to force the portable path.
+ */
+
+#ifndef SEEEDMMWAVE_BATCH_H
+#define SEEEDMMWAVE_BATCH_H
+
+#include "SeeedmmWaveFrame.h"
+
+/**
+ * @brief Decode 32-bit fields of `count` records into column arrays.
+ *
+ * @param data The first record.
+ * @param data_len The number of bytes available at `data`.
+ * @param stride The record size in bytes.
+ * @param count The number of records to decode.
+ * @param offsets Byte offset of each field inside a record.
+ * @param num_fields The number of fields.
+ * @param columns One array of at least `count` 32-bit elements per field.
+ * Element `i` of column `f` receives the raw field `f` of record `i`, so an
+ * array of float, int32_t or uint32_t may be passed.
+ * @retval true The records were decoded.
+ * @retval false A record or a field lies outside of `data`, nothing was
+ * written.
+ */
+bool mmWaveBatchLoad32(const uint8_t* data, size_t data_len, size_t stride,
+                       size_t count, const uint8_t* offsets, size_t num_fields,
+                       void* const* columns);
+
+/**
+ * @brief Name of the kernel selected at compile time, for benchmarks and
+ * logs: "avx2", "sse2", "neon" or "scalar".
+ */
+const char* mmWaveBatchKernel();
+
+#endif /*SEEEDMMWAVE_BATCH_H*/
@@ -0,0 +1,147 @@
+/**
+ * @file SeeedmmWaveClutter.cpp
+ * @date  18 October 2026
+ *
+ * @note Adaptive map of static reflectors, removed from point clouds.
+ *
+ * @copyright © 2024, Seeed Studio
+ */
+
+#include "SeeedmmWaveClutter.h"
+
+#include <math.h>
+#include <string.h>
+
+/* Cell coordinates are kept in 10 bits each, +-511 cells */
+#define MMWAVE_CLUTTER_COORD_BITS 10
+#define MMWAVE_CLUTTER_COORD_MAX  511
+
+void mmWaveClutterMap::begin(float cell_size, uint32_t half_life,
+                             float occupancy, float static_doppler) {
+  _inverse_cell    = cell_size > 0 ? 1.0f / cell_size : 5.0f;
+  _occupancy       = occupancy;
+  _static_doppler  = static_doppler;
+  _decay_per_frame = powf(0.5f, 1.0f / (half_life ? half_life : 1));
+  float decay      = 1;
+  for (size_t i = 0; i < MMWAVE_CLUTTER_DECAY_STEPS; i++) {
+    _decay[i] = decay;
+    decay *= _decay_per_frame;
+  }
+  _frozen = false;
+  relearn();
+}
+
+void mmWaveClutterMap::relearn() {
+  memset(_cells, 0, sizeof(_cells));
+  _frame = 1;
+}
+
+/* Nonzero for every cell, so 0 marks a free entry */
+uint32_t mmWaveClutterMap::keyOf(float x, float y, float z) const {
+  float position[3] = {x, y, z};
+  uint32_t key      = 1;
+  for (size_t i = 0; i < 3; i++) {
+    float cell = floorf(position[i] * _inverse_cell);
+    if (!(cell >= -MMWAVE_CLUTTER_COORD_MAX))  // also NaN
+      cell = -MMWAVE_CLUTTER_COORD_MAX;
+    if (cell > MMWAVE_CLUTTER_COORD_MAX)
+      cell = MMWAVE_CLUTTER_COORD_MAX;
+    uint32_t biased = static_cast<uint32_t>(
+        static_cast<int32_t>(cell) + MMWAVE_CLUTTER_COORD_MAX + 1);
+    key = (key << MMWAVE_CLUTTER_COORD_BITS) | biased;
+  }
+  return key;
+}
+
+float mmWaveClutterMap::decayed(const Cell& cell) const {
+  uint32_t age = _frame - cell.frame;
+  if (age < MMWAVE_CLUTTER_DECAY_STEPS)
+    return cell.score * _decay[age];
+  return cell.score * powf(_decay_per_frame, static_cast<float>(age));
+}
+
+static constexpr uint32_t mmWaveClutterLog2(uint32_t n) {
+  return n > 1 ? 1 + mmWaveClutterLog2(n / 2) : 0;
+}
+
+/* The two entries a key may use, by Fibonacci hashing: the top bits of the
+ * product depend on every bit of the key */
+static inline size_t mmWaveClutterSlot(uint32_t key) {
+  return static_cast<uint32_t>(key * 2654435761U) >>
+         (32 - mmWaveClutterLog2(MMWAVE_CLUTTER_CELLS));
+}
+
+mmWaveClutterMap::Cell* mmWaveClutterMap::find(uint32_t key) {
+  size_t slot = mmWaveClutterSlot(key);
+  if (_cells[slot].key == key)
+    return &_cells[slot];
+  slot ^= 1;
+  return _cells[slot].key == key ? &_cells[slot] : nullptr;
+}
+
+const mmWaveClutterMap::Cell* mmWaveClutterMap::find(uint32_t key) const {
+  return const_cast<mmWaveClutterMap*>(this)->find(key);
+}
+
+/* One hit per cell and frame */
+void mmWaveClutterMap::learn(uint32_t key) {
+  Cell* cell = find(key);
+  if (!cell) {
+    // Take the weaker of the two entries, or a free one
+    Cell* first  = &_cells[mmWaveClutterSlot(key)];
+    Cell* second = &_cells[mmWaveClutterSlot(key) ^ 1];
+    float score1 = first->key ? decayed(*first) : -1;
+    float score2 = second->key ? decayed(*second) : -1;
+    cell         = score1 <= score2 ? first : second;
+    cell->key    = key;
+    cell->score  = 0;
+    cell->frame  = _frame;
+  } else if (cell->frame == _frame) {
+    return;
+  }
+  cell->score = decayed(*cell) + (1 - _decay_per_frame);
+  cell->frame = _frame;
+}
+
+uint32_t mmWaveClutterMap::filter(PeopleCounting& cloud) {
+  std::vector<TargetN>& points = cloud.targets;
+  size_t kept                  = 0;
+  for (size_t i = 0; i < points.size(); i++) {
+    const TargetN& point = points[i];
+    float dop = point.dop_index < 0 ? -point.dop_index : point.dop_index;
+    if (dop <= _static_doppler) {
+      // Judged on the frames before this one, then learned
+      uint32_t key     = keyOf(point.x_point, point.y_point, point.z_point);
+      const Cell* cell = find(key);
+      bool clutter     = cell && decayed(*cell) >= _occupancy;
+      if (!_frozen)
+        learn(key);
+      if (clutter)
+        continue;
+    }
+    if (kept != i)
+      points[kept] = point;
+    kept++;
+  }
+
+  _removed_last = points.size() - kept;
+  _removed_total += _removed_last;
+  points.resize(kept);
+  if (!_frozen)
+    _frame++;
+  return _removed_last;
+}
+
+bool mmWaveClutterMap::isClutter(float x, float y, float z) const {
+  const Cell* cell = find(keyOf(x, y, z));
+  return cell && decayed(*cell) >= _occupancy;
+}
+
+size_t mmWaveClutterMap::cellCount() const {
+  size_t count = 0;
+  for (size_t i = 0; i < MMWAVE_CLUTTER_CELLS; i++) {
+    if (_cells[i].key)
+      count++;
+  }
+  return count;
+}
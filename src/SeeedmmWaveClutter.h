@@ -0,0 +1,115 @@
+/**
+ * @file SeeedmmWaveClutter.h
+ * @date  18 October 2026
+ *
+ * @note Adaptive map of static reflectors, removed from point clouds.
+ *
+ * @copyright © 2024, Seeed Studio
+ *
+ * @attention Space is cut into cubic cells of `cell_size`. Every cell that
+ * held a static point (|dop_index| at most `static_doppler`) in a frame
+ * counts a hit, and its score is an exponential average of those hits over
+ * the frames seen: 1 for a cell hit in every frame, 0 for one never hit,
+ * halving over `half_life` frames without hits. A cell scoring at least
+ * `occupancy` is clutter, and its static points are removed. Moving points
+ * are always kept and never learned. With the default occupancy of 0.8 a
+ * reflector present in every frame is learned after 2.3 half lives.
+ *
+ * The cells live in a hash table of MMWAVE_CLUTTER_CELLS entries, so the
+ * memory is fixed whatever the size of the room. Scores are decayed lazily,
+ * when a cell is next touched, so a frame costs O(points) and not O(cells).
+ * When two cells compete for an entry, the weaker is forgotten.
+ *
+ * A person who keeps still long enough is learned like furniture. Choose a
+ * half life well above the time someone sits still, or freeze() the map
+ * once the empty room has been learned and relearn() after it changed.
+ */
+
+#ifndef SEEEDMMWAVE_CLUTTER_H
+#define SEEEDMMWAVE_CLUTTER_H
+
+#include "SEEED_Public.h"
+
+/* Hash table entries, a power of two, 12 bytes each */
+#ifndef MMWAVE_CLUTTER_CELLS
+#  define MMWAVE_CLUTTER_CELLS 1024
+#endif
+
+static_assert((MMWAVE_CLUTTER_CELLS & (MMWAVE_CLUTTER_CELLS - 1)) == 0,
+              "MMWAVE_CLUTTER_CELLS must be a power of two");
+
+/* Frames of decay factors computed in advance, older cells use powf() */
+#define MMWAVE_CLUTTER_DECAY_STEPS 64
+
+class mmWaveClutterMap {
+ private:
+  struct Cell {
+    uint32_t key;    // packed cell coordinates, 0 for a free entry
+    uint32_t frame;  // frame the score was last updated
+    float score;
+  };
+
+  Cell _cells[MMWAVE_CLUTTER_CELLS];
+  float _decay[MMWAVE_CLUTTER_DECAY_STEPS];  // decay over n frames
+  float _decay_per_frame = 1;
+
+  float _inverse_cell   = 5;  // cells per metre
+  float _static_doppler = 0.05f;
+  float _occupancy      = 0.8f;
+  bool _frozen          = false;
+  uint32_t _frame       = 1;
+
+  uint32_t _removed_last  = 0;
+  uint32_t _removed_total = 0;
+
+  uint32_t keyOf(float x, float y, float z) const;
+  float decayed(const Cell& cell) const;
+  Cell* find(uint32_t key);
+  const Cell* find(uint32_t key) const;
+  void learn(uint32_t key);
+
+ public:
+  mmWaveClutterMap() {
+    begin();
+  }
+
+  /**
+   * @param cell_size Edge of a cell in metres.
+   * @param half_life Frames without hits that halve the score of a cell.
+   * @param occupancy Score from which a cell is clutter, 0 to 1.
+   * @param static_doppler Largest |dop_index| of a static point.
+   */
+  void begin(float cell_size = 0.2f, uint32_t half_life = 300,
+             float occupancy = 0.8f, float static_doppler = 0.05f);
+
+  /**
+   * @brief Learn from a cloud and remove its points in clutter cells.
+   *
+   * @return The number of points removed.
+   */
+  uint32_t filter(PeopleCounting& cloud);
+
+  /* A static point at (x, y, z) would be removed */
+  bool isClutter(float x, float y, float z) const;
+
+  /* Keep filtering with what was learned, but learn nothing more */
+  void freeze(bool frozen = true) {
+    _frozen = frozen;
+  }
+  bool frozen() const {
+    return _frozen;
+  }
+  /* Forget everything learned */
+  void relearn();
+
+  /* Cells in the table, whatever their score */
+  size_t cellCount() const;
+  uint32_t removedLast() const {
+    return _removed_last;
+  }
+  uint32_t removedTotal() const {
+    return _removed_total;
+  }
+};
+
+#endif /*SEEEDMMWAVE_CLUTTER_H*/
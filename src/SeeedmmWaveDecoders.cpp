@@ -0,0 +1,198 @@
+/**
+ * @file SeeedmmWaveDecoders.cpp
+ * @date  18 October 2026
+ *
+ * @note One decoder per report type, for composing an mmWaveDevice.
+ *
+ * @copyright © 2024, Seeed Studio
+ */
+
+#include "SeeedmmWaveDecoders.h"
+
+constexpr uint16_t mmWaveFallDecoder::kType;
+constexpr uint16_t mmWavePresenceDecoder::kType;
+constexpr uint16_t mmWaveFallPointCloudDecoder::kType;
+constexpr uint16_t mmWaveFallTargetInfoDecoder::kType;
+constexpr uint16_t mmWaveHeartBreathPhaseDecoder::kType;
+constexpr uint16_t mmWaveBreathRateDecoder::kType;
+constexpr uint16_t mmWaveHeartRateDecoder::kType;
+constexpr uint16_t mmWaveDistanceDecoder::kType;
+constexpr uint16_t mmWaveBreathPointCloudDecoder::kType;
+constexpr uint16_t mmWaveBreathTargetInfoDecoder::kType;
+
+bool mmWaveFallDecoder::decode(const uint8_t* data, size_t data_len) {
+  typedef mmWaveFallSchema<TypeFallDetection::ReportFallDetection> Schema;
+  if (!Schema::decode(data, data_len, _isFall))
+    return false;
+  _isFallValid = true;
+  return true;
+}
+
+bool mmWavePresenceDecoder::decode(const uint8_t* data, size_t data_len) {
+  typedef mmWaveFallSchema<TypeFallDetection::ReportUnmannedDetection> Schema;
+  if (!Schema::decode(data, data_len, _isHuman))
+    return false;
+  _isHumanValid = true;
+  return true;
+}
+
+bool mmWavePresenceDecoder::getHuman(bool& is_human) {
+  if (!_isHumanValid)
+    return false;
+  _isHumanValid = false;
+  is_human      = _isHuman;
+  return is_human;
+}
+
+bool mmWavePresenceDecoder::getHuman() {
+  if (!_isHumanValid)
+    return false;
+  _isHumanValid = false;
+  return _isHuman;
+}
+
+bool mmWaveFallPointCloudDecoder::decode(const uint8_t* data,
+                                         size_t data_len) {
+  typedef mmWaveFallSchema<TypeFallDetection::Report3DPointCloudDetection>
+      Schema;
+  if (!Schema::decode(data, data_len, _people_counting_point_cloud.targets))
+    return false;
+  _isPeopleCountingPointCloudValid = true;
+  return true;
+}
+
+bool mmWaveFallPointCloudDecoder::getPeopleCountingPointCloud(
+    PeopleCounting& point_cloud) {
+  if (!_isPeopleCountingPointCloudValid)
+    return false;
+  _isPeopleCountingPointCloudValid = false;
+  mmWaveTakeCloud(_people_counting_point_cloud, point_cloud);
+  return true;
+}
+
+bool mmWaveFallTargetInfoDecoder::decode(const uint8_t* data,
+                                         size_t data_len) {
+  typedef mmWaveFallSchema<TypeFallDetection::Report3DPointCloudTartgetInfo>
+      Schema;
+  if (!Schema::decode(data, data_len, _people_counting_target_info.targets))
+    return false;
+  _isPeopleCountingTartgetInfoValid = true;
+  return true;
+}
+
+bool mmWaveFallTargetInfoDecoder::getPeopleCountingTartgetInfo(
+    PeopleCounting& target_info) {
+  if (!_isPeopleCountingTartgetInfoValid)
+    return false;
+  _isPeopleCountingTartgetInfoValid = false;
+  mmWaveTakeCloud(_people_counting_target_info, target_info);
+  return true;
+}
+
+bool mmWaveHeartBreathPhaseDecoder::decode(const uint8_t* data,
+                                           size_t data_len) {
+  typedef mmWaveBreathSchema<TypeHeartBreath::TypeHeartBreathPhase> Schema;
+  if (!Schema::decode(data, data_len, _heart_breath))
+    return false;
+  _isHeartBreathPhaseValid = true;
+  return true;
+}
+
+bool mmWaveHeartBreathPhaseDecoder::getHeartBreathPhases(float& total_phase,
+                                                         float& breath_phase,
+                                                         float& heart_phase) {
+  if (!_isHeartBreathPhaseValid)
+    return false;
+  _isHeartBreathPhaseValid = false;
+
+  total_phase  = _heart_breath.total_phase;
+  breath_phase = _heart_breath.breath_phase;
+  heart_phase  = _heart_breath.heart_phase;
+  return true;
+}
+
+bool mmWaveBreathRateDecoder::decode(const uint8_t* data, size_t data_len) {
+  typedef mmWaveBreathSchema<TypeHeartBreath::TypeBreathRate> Schema;
+  if (!Schema::decode(data, data_len, _breath_rate))
+    return false;
+  _isBreathRateValid = true;
+  return true;
+}
+
+bool mmWaveBreathRateDecoder::getBreathRate(float& rate) {
+  if (!_isBreathRateValid)
+    return false;
+  _isBreathRateValid = false;
+  rate               = _breath_rate;
+  return true;
+}
+
+bool mmWaveHeartRateDecoder::decode(const uint8_t* data, size_t data_len) {
+  typedef mmWaveBreathSchema<TypeHeartBreath::TypeHeartRate> Schema;
+  if (!Schema::decode(data, data_len, _heart_rate))
+    return false;
+  _isHeartRateValid = true;
+  return true;
+}
+
+bool mmWaveHeartRateDecoder::getHeartRate(float& rate) {
+  if (!_isHeartRateValid)
+    return false;
+  _isHeartRateValid = false;
+  rate              = _heart_rate;
+  return true;
+}
+
+bool mmWaveDistanceDecoder::decode(const uint8_t* data, size_t data_len) {
+  typedef mmWaveBreathSchema<TypeHeartBreath::TypeHeartBreathDistance> Schema;
+  if (!Schema::decode(data, data_len, _distance))
+    return false;
+  _isDistanceValid = true;
+  return true;
+}
+
+bool mmWaveDistanceDecoder::getDistance(float& distance) {
+  if (!_isDistanceValid || !_distance.flag)
+    return false;
+  _isDistanceValid = false;
+  distance         = _distance.range;
+  return true;
+}
+
+bool mmWaveBreathPointCloudDecoder::decode(const uint8_t* data,
+                                           size_t data_len) {
+  typedef mmWaveBreathSchema<TypeHeartBreath::Report3DPointCloudDetection>
+      Schema;
+  if (!Schema::decode(data, data_len, _people_counting_point_cloud.targets))
+    return false;
+  _isPeopleCountingPointCloudValid = true;
+  return true;
+}
+
+bool mmWaveBreathPointCloudDecoder::getPeopleCountingPointCloud(
+    PeopleCounting& point_cloud) {
+  if (!_isPeopleCountingPointCloudValid)
+    return false;
+  _isPeopleCountingPointCloudValid = false;
+  mmWaveTakeCloud(_people_counting_point_cloud, point_cloud);
+  return true;
+}
+
+bool mmWaveBreathTargetInfoDecoder::decode(const uint8_t* data,
+                                           size_t data_len) {
+  typedef mmWaveBreathSchema<TypeHeartBreath::Report3DPointCloudTartgetInfo>
+      Schema;
+  if (!Schema::decode(data, data_len, _people_counting_target_info.targets))
+    return false;
+  _isPeopleCountingTartgetInfoValid = true;
+  return true;
+}
+
+bool mmWaveBreathTargetInfoDecoder::getPeopleCountingTartgetInfo(
+    PeopleCounting& target_info) {
+  if (!_isPeopleCountingTartgetInfoValid)
+    return false;
+  _isPeopleCountingTartgetInfoValid = false;
+  mmWaveTakeCloud(_people_counting_target_info, target_info);
+  return true;
+}
@@ -0,0 +1,207 @@
+/**
+ * @file SeeedmmWaveDecoders.h
+ * @date  18 October 2026
+ *
+ * @note One decoder per report type, for composing an mmWaveDevice.
+ *
+ * @copyright © 2024, Seeed Studio
+ *
+ * @attention Every decoder exposes `kType`, the frame type it handles, and
+ * `decode()`. The getters follow SEEED_MR60FDA2 and SEEED_MR60BHA2, so a
+ * device composed of decoders offers the same report API as the full class.
+ * With MMWAVE_STATIC_MEMORY, so do the clouds passed to their getters: call
+ * mmWaveReserveCloud() on them once, or the first get allocates.
+ */
+
+#ifndef SEEEDMMWAVE_DECODERS_H
+#define SEEEDMMWAVE_DECODERS_H
+
+#include "SEEED_Public.h"
+#include "SeeedmmWaveSchema.h"
+
+/* MR60FDA2 ReportFallDetection */
+class mmWaveFallDecoder {
+ protected:
+  bool _isFall      = false;
+  bool _isFallValid = false;
+
+ public:
+  static constexpr uint16_t kType =
+      static_cast<uint16_t>(TypeFallDetection::ReportFallDetection);
+
+  bool decode(const uint8_t* data, size_t data_len);
+
+  bool getFall(bool& is_fall) {
+    is_fall = _isFall;
+    return is_fall;
+  }
+  bool getFall() {
+    return _isFall;
+  }
+};
+
+/* MR60FDA2 ReportUnmannedDetection / MR60BHA2 ReportHumanDetection */
+class mmWavePresenceDecoder {
+ protected:
+  bool _isHuman      = false;
+  bool _isHumanValid = false;
+
+ public:
+  static constexpr uint16_t kType =
+      static_cast<uint16_t>(TypeFallDetection::ReportUnmannedDetection);
+
+  bool decode(const uint8_t* data, size_t data_len);
+
+  bool getHuman(bool& is_human);
+  bool getHuman();
+  bool isHumanDetected() {
+    return getHuman();
+  }
+};
+
+/* MR60FDA2 Report3DPointCloudDetection */
+class mmWaveFallPointCloudDecoder {
+ protected:
+  PeopleCounting _people_counting_point_cloud;
+  bool _isPeopleCountingPointCloudValid = false;
+
+ public:
+#if MMWAVE_STATIC_MEMORY
+  static constexpr size_t kReservedBytes = MMWAVE_MAX_POINTS * sizeof(TargetN);
+#endif
+
+  mmWaveFallPointCloudDecoder() {
+    mmWaveReserveCloud(_people_counting_point_cloud);
+  }
+
+  static constexpr uint16_t kType =
+      static_cast<uint16_t>(TypeFallDetection::Report3DPointCloudDetection);
+
+  bool decode(const uint8_t* data, size_t data_len);
+  bool getPeopleCountingPointCloud(PeopleCounting& point_cloud);
+};
+
+/* MR60FDA2 Report3DPointCloudTartgetInfo */
+class mmWaveFallTargetInfoDecoder {
+ protected:
+  PeopleCounting _people_counting_target_info;
+  bool _isPeopleCountingTartgetInfoValid = false;
+
+ public:
+#if MMWAVE_STATIC_MEMORY
+  static constexpr size_t kReservedBytes = MMWAVE_MAX_POINTS * sizeof(TargetN);
+#endif
+
+  mmWaveFallTargetInfoDecoder() {
+    mmWaveReserveCloud(_people_counting_target_info);
+  }
+
+  static constexpr uint16_t kType =
+      static_cast<uint16_t>(TypeFallDetection::Report3DPointCloudTartgetInfo);
+
+  bool decode(const uint8_t* data, size_t data_len);
+  bool getPeopleCountingTartgetInfo(PeopleCounting& target_info);
+};
+
+/* MR60BHA2 TypeHeartBreathPhase */
+class mmWaveHeartBreathPhaseDecoder {
+ protected:
+  HeartBreath _heart_breath     = {0, 0, 0};
+  bool _isHeartBreathPhaseValid = false;
+
+ public:
+  static constexpr uint16_t kType =
+      static_cast<uint16_t>(TypeHeartBreath::TypeHeartBreathPhase);
+
+  bool decode(const uint8_t* data, size_t data_len);
+  bool getHeartBreathPhases(float& total_phase, float& breath_phase,
+                            float& heart_phase);
+};
+
+/* MR60BHA2 TypeBreathRate */
+class mmWaveBreathRateDecoder {
+ protected:
+  float _breath_rate      = 0;
+  bool _isBreathRateValid = false;
+
+ public:
+  static constexpr uint16_t kType =
+      static_cast<uint16_t>(TypeHeartBreath::TypeBreathRate);
+
+  bool decode(const uint8_t* data, size_t data_len);
+  bool getBreathRate(float& rate);
+};
+
+/* MR60BHA2 TypeHeartRate */
+class mmWaveHeartRateDecoder {
+ protected:
+  float _heart_rate      = 0;
+  bool _isHeartRateValid = false;
+
+ public:
+  static constexpr uint16_t kType =
+      static_cast<uint16_t>(TypeHeartBreath::TypeHeartRate);
+
+  bool decode(const uint8_t* data, size_t data_len);
+  bool getHeartRate(float& rate);
+};
+
+/* MR60BHA2 TypeHeartBreathDistance */
+class mmWaveDistanceDecoder {
+ protected:
+  HeartBreathDistance _distance = {0, 0};
+  bool _isDistanceValid         = false;
+
+ public:
+  static constexpr uint16_t kType =
+      static_cast<uint16_t>(TypeHeartBreath::TypeHeartBreathDistance);
+
+  bool decode(const uint8_t* data, size_t data_len);
+  bool getDistance(float& distance);
+};
+
+/* MR60BHA2 Report3DPointCloudDetection */
+class mmWaveBreathPointCloudDecoder {
+ protected:
+  PeopleCounting _people_counting_point_cloud;
+  bool _isPeopleCountingPointCloudValid = false;
+
+ public:
+#if MMWAVE_STATIC_MEMORY
+  static constexpr size_t kReservedBytes = MMWAVE_MAX_POINTS * sizeof(TargetN);
+#endif
+
+  mmWaveBreathPointCloudDecoder() {
+    mmWaveReserveCloud(_people_counting_point_cloud);
+  }
+
+  static constexpr uint16_t kType =
+      static_cast<uint16_t>(TypeHeartBreath::Report3DPointCloudDetection);
+
+  bool decode(const uint8_t* data, size_t data_len);
+  bool getPeopleCountingPointCloud(PeopleCounting& point_cloud);
+};
+
+/* MR60BHA2 Report3DPointCloudTartgetInfo */
+class mmWaveBreathTargetInfoDecoder {
+ protected:
+  PeopleCounting _people_counting_target_info;
+  bool _isPeopleCountingTartgetInfoValid = false;
+
+ public:
+#if MMWAVE_STATIC_MEMORY
+  static constexpr size_t kReservedBytes = MMWAVE_MAX_POINTS * sizeof(TargetN);
+#endif
+
+  mmWaveBreathTargetInfoDecoder() {
+    mmWaveReserveCloud(_people_counting_target_info);
+  }
+
+  static constexpr uint16_t kType =
+      static_cast<uint16_t>(TypeHeartBreath::Report3DPointCloudTartgetInfo);
+
+  bool decode(const uint8_t* data, size_t data_len);
+  bool getPeopleCountingTartgetInfo(PeopleCounting& target_info);
+};
+
+#endif /*SEEEDMMWAVE_DECODERS_H*/
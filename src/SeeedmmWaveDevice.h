@@ -0,0 +1,197 @@
+/**
+ * @file SeeedmmWaveDevice.h
+ * @date  18 October 2026
+ *
+ * @note Compile-time composed mmWave front end.
+ *
+ * @copyright © 2024, Seeed Studio
+ *
+ * @attention mmWaveDevice<Transport, Decoders...> handles exactly the frame
+ * types of its decoders. Dispatch goes through a constant table generated
+ * from the decoder list instead of the virtual SeeedmmWave::handleType(), so
+ * decoders that a sketch does not list are never referenced and are dropped
+ * by the linker.
+ *
+ * Transport is any class providing `int available()`,
+ * `size_t readBytes(uint8_t*, size_t)` and
+ * `size_t write(const uint8_t*, size_t)`, e.g. HardwareSerial. It has to be
+ * started by the caller.
+ *
+ * @code
+ * mmWaveDevice<HardwareSerial, mmWaveFallDecoder, mmWavePresenceDecoder>
+ *     mmWave;
+ * mmWaveSerial.begin(115200);
+ * mmWave.begin(&mmWaveSerial);
+ * @endcode
+ */
+
+#ifndef SEEEDMMWAVE_DEVICE_H
+#define SEEEDMMWAVE_DEVICE_H
+
+#include "SeeedmmWaveDecoders.h"
+#include "SeeedmmWaveFrame.h"
+
+#ifndef MMWAVE_DEVICE_READ_CHUNK
+#  define MMWAVE_DEVICE_READ_CHUNK 64
+#endif
+
+/* Largest command payload send() accepts */
+#ifndef MMWAVE_DEVICE_TX_DATA
+#  define MMWAVE_DEVICE_TX_DATA 64
+#endif
+
+/* Compile-time checks over a decoder list */
+template <class... Decoders>
+struct mmWaveDecoderList;
+
+template <>
+struct mmWaveDecoderList<> {
+  static constexpr bool contains(uint16_t) {
+    return false;
+  }
+  static constexpr bool unique() {
+    return true;
+  }
+#if MMWAVE_STATIC_MEMORY
+  static constexpr size_t reservedBytes() {
+    return 0;
+  }
+#endif
+};
+
+template <class First, class... Rest>
+struct mmWaveDecoderList<First, Rest...> {
+  static constexpr bool contains(uint16_t type) {
+    return First::kType == type || mmWaveDecoderList<Rest...>::contains(type);
+  }
+  static constexpr bool unique() {
+    return !mmWaveDecoderList<Rest...>::contains(First::kType) &&
+           mmWaveDecoderList<Rest...>::unique();
+  }
+#if MMWAVE_STATIC_MEMORY
+  static constexpr size_t reservedBytes() {
+    return mmWaveReservedBytes<First>::value +
+           mmWaveDecoderList<Rest...>::reservedBytes();
+  }
+#endif
+};
+
+template <class Transport, class... Decoders>
+class mmWaveDevice : public Decoders... {
+  static_assert(sizeof...(Decoders) > 0, "mmWaveDevice needs a decoder");
+  static_assert(mmWaveDecoderList<Decoders...>::unique(),
+                "two decoders handle the same frame type");
+
+ private:
+  typedef bool (mmWaveDevice::*Handler)(const uint8_t*, size_t);
+
+  Transport* _transport = nullptr;
+  mmWaveFrameParser _parser;
+  uint16_t _id = 0x8000;
+
+  template <class Decoder>
+  bool decodeWith(const uint8_t* data, size_t data_len) {
+    return Decoder::decode(data, data_len);
+  }
+
+  bool dispatch(uint16_t type, const uint8_t* data, size_t data_len) {
+    static constexpr uint16_t kTypes[]     = {Decoders::kType...};
+    static constexpr Handler kHandlers[] = {
+        &mmWaveDevice::template decodeWith<Decoders>...};
+    for (size_t i = 0; i < sizeof...(Decoders); i++) {
+      if (kTypes[i] == type)
+        return (this->*kHandlers[i])(data, data_len);
+    }
+    return false;
+  }
+
+ public:
+#if MMWAVE_STATIC_MEMORY
+  static constexpr size_t kReservedBytes =
+      mmWaveDecoderList<Decoders...>::reservedBytes();
+#endif
+
+  mmWaveDevice() {}
+
+  void begin(Transport* transport) {
+    _transport = transport;
+    _parser.reset();
+  }
+
+  /**
+   * @brief Whether a frame type is handled by this composition.
+   */
+  static constexpr bool handles(uint16_t type) {
+    return mmWaveDecoderList<Decoders...>::contains(type);
+  }
+
+  /**
+   * @brief Validate a complete frame and hand it to its decoder.
+   *
+   * @param frame The frame, starting with SOF_BYTE.
+   * @param len The frame length.
+   * @return true if a decoder accepted the frame.
+   */
+  bool processFrame(const uint8_t* frame, size_t len) {
+    if (!mmWaveValidateFrame(frame, len))
+      return false;
+    return dispatch(mmWaveFrameType(frame), frame + SIZE_FRAME_HEADER,
+                    mmWaveFrameDataLength(frame));
+  }
+
+  /**
+   * @brief Decode every complete frame already received, without waiting.
+   *
+   * @return true if at least one frame was decoded.
+   */
+  bool update() {
+    if (!_transport)
+      return false;
+
+    bool result = false;
+    uint8_t chunk[MMWAVE_DEVICE_READ_CHUNK];
+    int available;
+    while ((available = _transport->available()) > 0) {
+      size_t want = static_cast<size_t>(available) < sizeof(chunk)
+                        ? static_cast<size_t>(available)
+                        : sizeof(chunk);
+      size_t got = _transport->readBytes(chunk, want);
+      if (got == 0)
+        break;
+      for (size_t i = 0; i < got; i++) {
+        if (_parser.push(chunk[i]) &&
+            processFrame(_parser.frame(), _parser.length()))
+          result = true;
+      }
+    }
+    return result;
+  }
+
+  /**
+   * @brief Send a frame of data. Responses are only decoded if the matching
+   * decoder is part of the composition.
+   */
+  bool send(uint16_t type, const uint8_t* data = nullptr, size_t len = 0) {
+    if (!_transport || len > MMWAVE_DEVICE_TX_DATA)
+      return false;
+    uint8_t frame[SIZE_FRAME_HEADER + MMWAVE_DEVICE_TX_DATA + SIZE_DATA_CKSUM];
+    size_t size =
+        mmWaveBuildFrame(frame, sizeof(frame), _id++, type, data, len);
+    return size && _transport->write(frame, size) == size;
+  }
+};
+
+/* Report-only compositions of the two modules */
+template <class Transport>
+using MR60FDA2Device =
+    mmWaveDevice<Transport, mmWaveFallDecoder, mmWavePresenceDecoder,
+                 mmWaveFallPointCloudDecoder, mmWaveFallTargetInfoDecoder>;
+
+template <class Transport>
+using MR60BHA2Device =
+    mmWaveDevice<Transport, mmWaveHeartBreathPhaseDecoder,
+                 mmWaveBreathRateDecoder, mmWaveHeartRateDecoder,
+                 mmWaveDistanceDecoder, mmWavePresenceDecoder,
+                 mmWaveBreathPointCloudDecoder, mmWaveBreathTargetInfoDecoder>;
+
+#endif /*SEEEDMMWAVE_DEVICE_H*/
@@ -0,0 +1,322 @@
+/**
+ * @file SeeedmmWaveFallRecorder.cpp
+ * @date  18 October 2026
+ *
+ * @note Fall-event "black box" for the MR60FDA2.
+ *
+ * @copyright © 2024, Seeed Studio
+ */
+
+#include "SeeedmmWaveFallRecorder.h"
+
+static int16_t quantize(float value, float scale) {
+  float scaled = value * scale;
+  if (scaled >= 32767.0f)
+    return 32767;
+  if (scaled <= -32768.0f)
+    return -32768;
+  return static_cast<int16_t>(scaled < 0 ? scaled - 0.5f : scaled + 0.5f);
+}
+
+static uint8_t* putU16(uint8_t* p, uint16_t v) {
+  p[0] = v & 0xFF;
+  p[1] = v >> 8;
+  return p + 2;
+}
+
+static uint8_t* putU32(uint8_t* p, uint32_t v) {
+  p[0] = v & 0xFF;
+  p[1] = (v >> 8) & 0xFF;
+  p[2] = (v >> 16) & 0xFF;
+  p[3] = v >> 24;
+  return p + 4;
+}
+
+/**
+ * @brief Configure the recording windows and clear the history.
+ *
+ * @param pre_ms History kept before the fall trigger.
+ * @param post_ms History collected after the fall trigger.
+ * @param rearm_ms Time the fall flag must stay clear before a new event can
+ * be triggered. Repeated fall frames within this time never start a new event.
+ *
+ * @note The windows are bounded by MMWAVE_FALL_HISTORY_FRAMES entries; if the
+ * radar reports faster than the ring can hold, the pre-trigger window is the
+ * oldest entries still in the ring and the post-trigger window ends early.
+ */
+void mmWaveFallRecorder::begin(uint32_t pre_ms, uint32_t post_ms,
+                               uint32_t rearm_ms) {
+  _pre_ms   = pre_ms;
+  _post_ms  = post_ms;
+  _rearm_ms = rearm_ms;
+  reset();
+}
+
+void mmWaveFallRecorder::reset() {
+  _head          = 0;
+  _count         = 0;
+  _state         = FallRecorderState::Armed;
+  _isHuman       = false;
+  _isFall        = false;
+  _fall_clear_ms = 0;
+  _trigger_ms    = 0;
+  _event_first   = 0;
+  _event_count   = 0;
+}
+
+uint8_t mmWaveFallRecorder::currentFlags() const {
+  uint8_t flags = 0;
+  if (_isHuman)
+    flags |= MMWAVE_FALL_FLAG_HUMAN;
+  if (_isFall)
+    flags |= MMWAVE_FALL_FLAG_FALL;
+  return flags;
+}
+
+mmWaveFallFrame& mmWaveFallRecorder::append(uint32_t now, uint8_t flags) {
+  mmWaveFallFrame& frame = _frames[_head];
+  frame.timestamp_ms     = now;
+  frame.flags            = flags;
+  frame.num_points       = 0;
+  frame.dropped_points   = 0;
+
+  _head = (_head + 1) % MMWAVE_FALL_HISTORY_FRAMES;
+  if (_count < MMWAVE_FALL_HISTORY_FRAMES)
+    _count++;
+  return frame;
+}
+
+void mmWaveFallRecorder::trigger(uint32_t now) {
+  _trigger_ms = now;
+  _state      = FallRecorderState::PostTrigger;
+
+  // Walk back from the newest entry to the oldest one inside the pre window.
+  // At most half of the ring is used for it, the rest is kept for the post
+  // window.
+  uint16_t newest = (_head + MMWAVE_FALL_HISTORY_FRAMES - 1) %
+                    MMWAVE_FALL_HISTORY_FRAMES;
+  _event_first = newest;
+  _event_count = 1;
+  while (_event_count < _count &&
+         _event_count < MMWAVE_FALL_HISTORY_FRAMES / 2) {
+    uint16_t prev = (_event_first + MMWAVE_FALL_HISTORY_FRAMES - 1) %
+                    MMWAVE_FALL_HISTORY_FRAMES;
+    if (now - _frames[prev].timestamp_ms > _pre_ms)
+      break;
+    _event_first = prev;
+    _event_count++;
+  }
+}
+
+void mmWaveFallRecorder::freeze() {
+  _state = FallRecorderState::EventReady;
+  _events_total++;
+}
+
+/**
+ * @brief Account for an entry appended during the post-trigger window.
+ *
+ * @note The event is frozen as soon as it fills the ring, so the next
+ * append can never overwrite its first entry.
+ */
+void mmWaveFallRecorder::extendEvent() {
+  if (_state != FallRecorderState::PostTrigger)
+    return;
+  _event_count++;
+  if (_event_count >= MMWAVE_FALL_HISTORY_FRAMES)
+    freeze();
+}
+
+/**
+ * @brief Move the debounce state machine forward.
+ *
+ * @param now Current time in milliseconds.
+ */
+void mmWaveFallRecorder::advance(uint32_t now) {
+  switch (_state) {
+    case FallRecorderState::PostTrigger:
+      if (now - _trigger_ms >= _post_ms)
+        freeze();
+      break;
+    case FallRecorderState::Rearming:
+      if (!_isFall && now - _fall_clear_ms >= _rearm_ms)
+        _state = FallRecorderState::Armed;
+      break;
+    default:
+      break;
+  }
+}
+
+/**
+ * @brief Record a decoded point cloud.
+ *
+ * @param now Current time in milliseconds.
+ * @param cloud The decoded point cloud.
+ */
+void mmWaveFallRecorder::onPointCloud(uint32_t now,
+                                      const PeopleCounting& cloud) {
+  advance(now);
+  if (_state == FallRecorderState::EventReady)
+    return;
+
+  mmWaveFallFrame& frame = append(now, currentFlags() | MMWAVE_FALL_FLAG_CLOUD);
+  size_t total           = cloud.targets.size();
+  size_t kept = total < MMWAVE_FALL_MAX_POINTS ? total : MMWAVE_FALL_MAX_POINTS;
+  for (size_t i = 0; i < kept; i++) {
+    const TargetN& target    = cloud.targets[i];
+    mmWaveQuantPoint& point  = frame.points[i];
+    point.x_mm               = quantize(target.x_point, 1000.0f);
+    point.y_mm               = quantize(target.y_point, 1000.0f);
+    point.z_mm               = quantize(target.z_point, 1000.0f);
+    point.dop_mm_s           = quantize(target.dop_index, 1000.0f);
+    int32_t cluster          = target.cluster_index;
+    point.cluster = cluster > 127 ? 127 : (cluster < -128 ? -128 : cluster);
+  }
+  frame.num_points     = kept;
+  frame.dropped_points = total - kept > 255 ? 255 : total - kept;
+
+  extendEvent();
+}
+
+/**
+ * @brief Record a presence report. An entry is only added when the state
+ * changes, so the history stays compact while nobody moves.
+ */
+void mmWaveFallRecorder::onHuman(uint32_t now, bool is_human) {
+  advance(now);
+  if (is_human == _isHuman)
+    return;
+  _isHuman = is_human;
+  if (_state == FallRecorderState::EventReady)
+    return;
+
+  append(now, currentFlags());
+  extendEvent();
+}
+
+/**
+ * @brief Record a fall report and trigger an event on a debounced rising
+ * edge.
+ */
+void mmWaveFallRecorder::onFall(uint32_t now, bool is_fall) {
+  bool changed = is_fall != _isFall;
+  if (changed && !is_fall)
+    _fall_clear_ms = now;
+  _isFall = is_fall;
+  advance(now);
+
+  if (_state == FallRecorderState::EventReady || !changed)
+    return;
+
+  bool fire = is_fall && _state == FallRecorderState::Armed;
+  append(now, currentFlags() | (fire ? MMWAVE_FALL_FLAG_TRIGGER : 0));
+  if (fire) {
+    trigger(now);
+  } else {
+    extendEvent();
+  }
+}
+
+/**
+ * @brief Advance the timers without new data, e.g. from loop() when the
+ * radar is quiet, so the post-trigger window still closes on time.
+ */
+void mmWaveFallRecorder::poll(uint32_t now) {
+  advance(now);
+}
+
+/**
+ * @brief Release a frozen event and resume recording. A new event can only
+ * be triggered after the fall flag has been clear for the rearm time.
+ */
+void mmWaveFallRecorder::release() {
+  if (_state != FallRecorderState::EventReady)
+    return;
+  _event_count = 0;
+  _state       = FallRecorderState::Rearming;
+}
+
+uint16_t mmWaveFallRecorder::eventFrameCount() const {
+  return _state == FallRecorderState::Armed ||
+                 _state == FallRecorderState::Rearming
+             ? 0
+             : _event_count;
+}
+
+/**
+ * @brief Access an entry of the current event, oldest first.
+ *
+ * @param index 0 to eventFrameCount() - 1.
+ * @return The entry or nullptr if out of range.
+ */
+const mmWaveFallFrame* mmWaveFallRecorder::eventFrame(uint16_t index) const {
+  if (index >= eventFrameCount())
+    return nullptr;
+  return &_frames[(_event_first + index) % MMWAVE_FALL_HISTORY_FRAMES];
+}
+
+size_t mmWaveFallRecorder::serializedSize() const {
+  if (!available())
+    return 0;
+  size_t size = MMWAVE_FALL_RECORD_HEADER_SIZE + 1;  // header + checksum
+  for (uint16_t i = 0; i < _event_count; i++) {
+    size += MMWAVE_FALL_RECORD_FRAME_SIZE +
+            eventFrame(i)->num_points * MMWAVE_FALL_RECORD_POINT_SIZE;
+  }
+  return size;
+}
+
+/**
+ * @brief Serialise the frozen event into a compact little-endian record.
+ *
+ * Layout:
+ * - header (16 bytes): magic u16, version u8, max points u8, trigger
+ *   timestamp u32, pre window u16 (ms), post window u16 (ms), entry count
+ *   u16, event sequence u16
+ * - per entry (7 bytes): timestamp relative to the trigger i32 (ms), flags
+ *   u8, point count u8, dropped points u8
+ * - per point (9 bytes): x, y, z i16 (mm), doppler i16 (mm/s), cluster i8
+ * - checksum u8: inverted XOR over everything before it
+ *
+ * @param out Destination buffer.
+ * @param capacity Size of the destination buffer.
+ * @return Bytes written, 0 if no event is ready or the buffer is too small.
+ */
+size_t mmWaveFallRecorder::serialize(uint8_t* out, size_t capacity) const {
+  size_t size = serializedSize();
+  if (size == 0 || capacity < size)
+    return 0;
+
+  uint8_t* p = out;
+  p          = putU16(p, MMWAVE_FALL_RECORD_MAGIC);
+  *p++       = MMWAVE_FALL_RECORD_VERSION;
+  *p++       = MMWAVE_FALL_MAX_POINTS;
+  p          = putU32(p, _trigger_ms);
+  p          = putU16(p, _pre_ms > 0xFFFF ? 0xFFFF : _pre_ms);
+  p          = putU16(p, _post_ms > 0xFFFF ? 0xFFFF : _post_ms);
+  p          = putU16(p, _event_count);
+  p          = putU16(p, _events_total);
+
+  for (uint16_t i = 0; i < _event_count; i++) {
+    const mmWaveFallFrame* frame = eventFrame(i);
+    p    = putU32(p, frame->timestamp_ms - _trigger_ms);
+    *p++ = frame->flags;
+    *p++ = frame->num_points;
+    *p++ = frame->dropped_points;
+    for (uint8_t j = 0; j < frame->num_points; j++) {
+      const mmWaveQuantPoint& point = frame->points[j];
+      p    = putU16(p, point.x_mm);
+      p    = putU16(p, point.y_mm);
+      p    = putU16(p, point.z_mm);
+      p    = putU16(p, point.dop_mm_s);
+      *p++ = static_cast<uint8_t>(point.cluster);
+    }
+  }
+
+  uint8_t checksum = 0;
+  for (uint8_t* q = out; q < p; q++) {
+    checksum ^= *q;
+  }
+  *p++ = ~checksum;
+  return p - out;
+}
@@ -0,0 +1,127 @@
+/**
+ * @file SeeedmmWaveFallRecorder.h
+ * @date  18 October 2026
+ *
+ * @note Fall-event "black box" for the MR60FDA2.
+ *
+ * @copyright © 2024, Seeed Studio
+ *
+ * @attention The recorder keeps a fixed-size circular history of quantised
+ * point clouds and presence/fall states. When a fall is reported it freezes
+ * the pre-trigger window, keeps collecting a post-trigger window, and then
+ * holds the whole event until it is released.
+ */
+
+#ifndef SEEEDMMWAVE_FALL_RECORDER_H
+#define SEEEDMMWAVE_FALL_RECORDER_H
+
+#include "SEEED_Public.h"
+
+/* Number of history entries (point-cloud frames and state changes). */
+#ifndef MMWAVE_FALL_HISTORY_FRAMES
+#  define MMWAVE_FALL_HISTORY_FRAMES 64
+#endif
+
+/* Points kept per entry, extra points are counted but not stored. */
+#ifndef MMWAVE_FALL_MAX_POINTS
+#  define MMWAVE_FALL_MAX_POINTS 16
+#endif
+
+#define MMWAVE_FALL_FLAG_HUMAN   0x01
+#define MMWAVE_FALL_FLAG_FALL    0x02
+#define MMWAVE_FALL_FLAG_CLOUD   0x04
+#define MMWAVE_FALL_FLAG_TRIGGER 0x08
+
+#define MMWAVE_FALL_RECORD_MAGIC   0x464D  // "MF", little-endian
+#define MMWAVE_FALL_RECORD_VERSION 1
+
+/* Serialised sizes, see mmWaveFallRecorder::serialize() */
+#define MMWAVE_FALL_RECORD_HEADER_SIZE 16
+#define MMWAVE_FALL_RECORD_FRAME_SIZE  7
+#define MMWAVE_FALL_RECORD_POINT_SIZE  9
+
+typedef struct mmWaveQuantPoint {
+  int16_t x_mm;
+  int16_t y_mm;
+  int16_t z_mm;
+  int16_t dop_mm_s;  // dop_index is reported in m/s
+  int8_t cluster;
+} mmWaveQuantPoint;
+
+typedef struct mmWaveFallFrame {
+  uint32_t timestamp_ms;
+  uint8_t flags;           // MMWAVE_FALL_FLAG_*
+  uint8_t num_points;      // points stored in `points`
+  uint8_t dropped_points;  // points that did not fit, saturated at 255
+  mmWaveQuantPoint points[MMWAVE_FALL_MAX_POINTS];
+} mmWaveFallFrame;
+
+enum class FallRecorderState : uint8_t {
+  Armed,        // recording, waiting for a fall
+  PostTrigger,  // fall seen, collecting the post-trigger window
+  EventReady,   // event frozen, waiting for release()
+  Rearming,     // recording, waiting for the fall flag to clear
+};
+
+class mmWaveFallRecorder {
+ private:
+  mmWaveFallFrame _frames[MMWAVE_FALL_HISTORY_FRAMES];
+  uint16_t _head  = 0;  // next slot to write
+  uint16_t _count = 0;  // valid entries in the ring
+
+  uint32_t _pre_ms   = 3000;
+  uint32_t _post_ms  = 2000;
+  uint32_t _rearm_ms = 5000;
+
+  FallRecorderState _state = FallRecorderState::Armed;
+  bool _isHuman            = false;
+  bool _isFall             = false;
+  uint32_t _fall_clear_ms  = 0;  // time the fall flag last went false
+
+  uint32_t _trigger_ms   = 0;
+  uint16_t _event_first  = 0;  // ring index of the first event entry
+  uint16_t _event_count  = 0;
+  uint16_t _events_total = 0;
+
+  uint8_t currentFlags() const;
+  mmWaveFallFrame& append(uint32_t now, uint8_t flags);
+  void trigger(uint32_t now);
+  void freeze();
+  void extendEvent();
+  void advance(uint32_t now);
+
+ public:
+  mmWaveFallRecorder() {}
+
+  void begin(uint32_t pre_ms = 3000, uint32_t post_ms = 2000,
+             uint32_t rearm_ms = 5000);
+  void reset();
+
+  void onPointCloud(uint32_t now, const PeopleCounting& cloud);
+  void onHuman(uint32_t now, bool is_human);
+  void onFall(uint32_t now, bool is_fall);
+  void poll(uint32_t now);
+
+  FallRecorderState state() const {
+    return _state;
+  }
+  bool available() const {
+    return _state == FallRecorderState::EventReady;
+  }
+  uint16_t eventCount() const {
+    return _events_total;
+  }
+
+  uint32_t triggerTimestamp() const {
+    return _trigger_ms;
+  }
+  uint16_t eventFrameCount() const;
+  const mmWaveFallFrame* eventFrame(uint16_t index) const;
+
+  size_t serializedSize() const;
+  size_t serialize(uint8_t* out, size_t capacity) const;
+
+  void release();
+};
+
+#endif /*SEEEDMMWAVE_FALL_RECORDER_H*/
@@ -0,0 +1,138 @@
+/**
+ * @file SeeedmmWaveFrame.cpp
+ * @date  18 October 2026
+ *
+ * @note Transport independent part of the mmWave tiny frame protocol.
+ *
+ * @copyright © 2024, Seeed Studio
+ */
+
+#include "SeeedmmWaveFrame.h"
+
+/**
+ * @brief Calculate the checksum for a byte array.
+ *
+ * @param data The byte array to calculate the checksum for.
+ * @param len The length of the byte array.
+ * @return The inverted XOR of all bytes.
+ */
+uint8_t mmWaveChecksum(const uint8_t* data, size_t len) {
+  uint8_t checksum = 0;
+  for (size_t i = 0; i < len; i++) {
+    checksum ^= data[i];
+  }
+  return ~checksum;
+}
+
+/**
+ * @brief Validate a complete frame.
+ *
+ * @param frame The frame, starting with SOF_BYTE.
+ * @param len The number of bytes available in `frame`.
+ * @retval true The length matches the header and both checksums are valid.
+ * @retval false Otherwise.
+ */
+bool mmWaveValidateFrame(const uint8_t* frame, size_t len) {
+  if (len < SIZE_FRAME_HEADER)
+    return false;
+
+  size_t data_len = mmWaveFrameDataLength(frame);
+  if (mmWaveChecksum(frame, SIZE_FRAME_HEADER - SIZE_HEAD_CKSUM) !=
+      frame[SIZE_FRAME_HEADER - SIZE_HEAD_CKSUM])
+    return false;
+  if (len < SIZE_FRAME_HEADER + data_len + SIZE_DATA_CKSUM)
+    return false;
+  return mmWaveChecksum(frame + SIZE_FRAME_HEADER, data_len) ==
+         frame[SIZE_FRAME_HEADER + data_len];
+}
+
+/**
+ * @brief Build a frame: SOF, ID, LEN, TYPE, HEAD_CKSUM, DATA, DATA_CKSUM.
+ *
+ * @param out The destination buffer.
+ * @param capacity The size of the destination buffer.
+ * @param id The frame id.
+ * @param type The frame type.
+ * @param data The payload, the data checksum is only appended when a payload
+ * is given.
+ * @param len The payload length.
+ * @return The frame size, 0 if it does not fit into `out`.
+ */
+size_t mmWaveBuildFrame(uint8_t* out, size_t capacity, uint16_t id,
+                        uint16_t type, const uint8_t* data, size_t len) {
+  size_t size = SIZE_FRAME_HEADER + (data ? len + SIZE_DATA_CKSUM : 0);
+  if (size > capacity || len > 0xFFFF)
+    return 0;
+
+  out[0] = SOF_BYTE;
+  out[1] = id >> 8;
+  out[2] = id & 0xFF;
+  out[3] = len >> 8;
+  out[4] = len & 0xFF;
+  out[5] = type >> 8;
+  out[6] = type & 0xFF;
+  out[7] = mmWaveChecksum(out, SIZE_FRAME_HEADER - SIZE_HEAD_CKSUM);
+
+  if (data != nullptr) {
+    memcpy(out + SIZE_FRAME_HEADER, data, len);
+    out[SIZE_FRAME_HEADER + len] = mmWaveChecksum(data, len);
+  }
+  return size;
+}
+
+void mmWaveFrameParser::reset() {
+  _length   = 0;
+  _expected = 0;
+  _complete = false;
+}
+
+/**
+ * @brief Drop the current header and replay the bytes after its SOF_BYTE, so
+ * a corrupted header cannot swallow the frame that follows it.
+ */
+void mmWaveFrameParser::resync() {
+  uint8_t pending[SIZE_FRAME_HEADER - SIZE_SOF];
+  size_t count = _length - SIZE_SOF;
+  memcpy(pending, _buffer + SIZE_SOF, count);
+
+  _dropped++;
+  _length   = 0;
+  _expected = 0;
+  for (size_t i = 0; i < count; i++) {
+    push(pending[i]);  // too short to complete a frame
+  }
+}
+
+/**
+ * @brief Feed one received byte.
+ *
+ * @param byte The received byte.
+ * @retval true A complete frame is available through frame() and length().
+ * @retval false More bytes are needed.
+ */
+bool mmWaveFrameParser::push(uint8_t byte) {
+  if (_complete) {
+    _length   = 0;
+    _expected = 0;
+    _complete = false;
+  }
+  if (_length == 0 && byte != SOF_BYTE)
+    return false;
+
+  _buffer[_length++] = byte;
+  if (_length == SIZE_FRAME_HEADER) {
+    size_t data_len = mmWaveFrameDataLength(_buffer);
+    if (data_len > MMWAVE_MAX_FRAME_DATA ||
+        mmWaveChecksum(_buffer, SIZE_FRAME_HEADER - SIZE_HEAD_CKSUM) !=
+            _buffer[SIZE_FRAME_HEADER - SIZE_HEAD_CKSUM]) {
+      resync();
+      return false;
+    }
+    _expected = SIZE_FRAME_HEADER + data_len + SIZE_DATA_CKSUM;
+  }
+  if (_length >= SIZE_FRAME_HEADER && _length == _expected) {
+    _complete = true;
+    return true;
+  }
+  return false;
+}
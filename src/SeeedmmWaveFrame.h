@@ -0,0 +1,157 @@
+/**
+ * @file SeeedmmWaveFrame.h
+ * @date  18 October 2026
+ *
+ * @note Transport independent part of the mmWave tiny frame protocol.
+ *
+ * @copyright © 2024, Seeed Studio
+ *
+ * @attention This header does not depend on Arduino, so the frame layout,
+ * checksums and the frame parser can be shared by the sensor classes and by
+ * host side tools.
+ */
+
+#ifndef SEEEDMMWAVE_FRAME_H
+#define SEEEDMMWAVE_FRAME_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define SOF_BYTE 0x01
+
+// Frame structure sizes
+#define SIZE_SOF        1
+#define SIZE_ID         2
+#define SIZE_LEN        2
+#define SIZE_TYPE       2
+#define SIZE_HEAD_CKSUM 1
+#define SIZE_FRAME_HEADER                                                      \
+  (SIZE_SOF + SIZE_ID + SIZE_LEN + SIZE_TYPE + SIZE_HEAD_CKSUM)
+#define SIZE_DATA_CKSUM 1
+
+/* 1: size every buffer at compile time, no heap use after begin() */
+#ifndef MMWAVE_STATIC_MEMORY
+#  define MMWAVE_STATIC_MEMORY 0
+#endif
+
+/* Largest payload accepted from the radar, longer frames are discarded */
+#ifndef MMWAVE_MAX_FRAME_DATA
+#  define MMWAVE_MAX_FRAME_DATA 1024
+#endif
+#define MMWAVE_MAX_FRAME_SIZE                                                  \
+  (SIZE_FRAME_HEADER + MMWAVE_MAX_FRAME_DATA + SIZE_DATA_CKSUM)
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#  define SEEED_WAVE_IS_BIG_ENDIAN 1
+#elif defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#  define SEEED_WAVE_IS_BIG_ENDIAN 0
+#else
+#  warning "Unable to determine the size end system"
+#endif
+
+/* Header fields are big-endian on the wire */
+inline uint16_t mmWaveFrameId(const uint8_t* frame) {
+  return (frame[1] << 8) | frame[2];
+}
+inline uint16_t mmWaveFrameDataLength(const uint8_t* frame) {
+  return (frame[3] << 8) | frame[4];
+}
+inline uint16_t mmWaveFrameType(const uint8_t* frame) {
+  return (frame[5] << 8) | frame[6];
+}
+
+/* Payload fields are little-endian and not aligned */
+inline uint32_t mmWaveLoadU32(const uint8_t* bytes) {
+  uint32_t value;
+  memcpy(&value, bytes, sizeof(value));
+#if SEEED_WAVE_IS_BIG_ENDIAN == 1
+  value = __builtin_bswap32(value);
+#endif
+  return value;
+}
+inline int32_t mmWaveLoadI32(const uint8_t* bytes) {
+  return static_cast<int32_t>(mmWaveLoadU32(bytes));
+}
+inline float mmWaveLoadFloat(const uint8_t* bytes) {
+  uint32_t bits = mmWaveLoadU32(bytes);
+  float value;
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+#if MMWAVE_STATIC_MEMORY
+/* Heap reserved at construction, 0 unless the class declares kReservedBytes */
+template <class T, class = void>
+struct mmWaveReservedBytes {
+  static constexpr size_t value = 0;
+};
+
+template <class T>
+struct mmWaveReservedBytes<T, decltype(void(T::kReservedBytes))> {
+  static constexpr size_t value = T::kReservedBytes;
+};
+
+/**
+ * @brief RAM used by a sensor or device object with MMWAVE_STATIC_MEMORY:
+ * the object, which holds the parser and queue buffers, plus the buffers it
+ * reserves when constructed. Nothing is allocated after begin(). The UART
+ * driver buffer (MMWAVE_RX_BUFFER_SIZE) belongs to the core and is not
+ * included.
+ *
+ * @code
+ * static_assert(mmWaveRamFootprint<SEEED_MR60FDA2>() < 24 * 1024, "");
+ * @endcode
+ */
+template <class T>
+constexpr size_t mmWaveRamFootprint() {
+  return sizeof(T) + mmWaveReservedBytes<T>::value;
+}
+#endif
+
+uint8_t mmWaveChecksum(const uint8_t* data, size_t len);
+bool mmWaveValidateFrame(const uint8_t* frame, size_t len);
+size_t mmWaveBuildFrame(uint8_t* out, size_t capacity, uint16_t id,
+                        uint16_t type, const uint8_t* data = nullptr,
+                        size_t len = 0);
+
+/**
+ * @brief Incremental frame reassembly.
+ *
+ * Bytes are pushed one at a time. The parser synchronises on SOF_BYTE,
+ * checks the header checksum as soon as the header is complete, and
+ * discards frames whose payload exceeds MMWAVE_MAX_FRAME_DATA. The data
+ * checksum is left to mmWaveValidateFrame().
+ */
+class mmWaveFrameParser {
+ private:
+  uint8_t _buffer[MMWAVE_MAX_FRAME_SIZE];
+  size_t _length    = 0;
+  size_t _expected  = 0;
+  bool _complete    = false;
+  uint32_t _dropped = 0;
+
+  void resync();
+
+ public:
+  mmWaveFrameParser() {}
+
+  void reset();
+  bool push(uint8_t byte);
+
+  /* Valid after push() returned true, until the next push() */
+  const uint8_t* frame() const {
+    return _buffer;
+  }
+  size_t length() const {
+    return _length;
+  }
+  bool inFrame() const {
+    return _length > 0 && !_complete;
+  }
+  uint32_t droppedFrames() const {
+    return _dropped;
+  }
+};
+
+#endif /*SEEEDMMWAVE_FRAME_H*/
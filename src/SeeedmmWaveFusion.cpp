@@ -0,0 +1,244 @@
+/**
+ * @file SeeedmmWaveFusion.cpp
+ * @date  18 October 2026
+ *
+ * @note Point-cloud fusion of several radars into one world frame.
+ *
+ * @copyright © 2024, Seeed Studio
+ */
+
+#include "SeeedmmWaveFusion.h"
+
+#include <math.h>
+#include <string.h>
+
+void mmWaveBuildTransform(const mmWaveExtrinsics& extrinsics, float m[12]) {
+  const float cy = cosf(extrinsics.yaw);
+  const float sy = sinf(extrinsics.yaw);
+  const float cp = cosf(extrinsics.pitch);
+  const float sp = sinf(extrinsics.pitch);
+
+  // R = Rz(yaw) * Rx(pitch), t = (x, y, height)
+  m[0]  = cy;
+  m[1]  = -sy * cp;
+  m[2]  = sy * sp;
+  m[3]  = extrinsics.x;
+  m[4]  = sy;
+  m[5]  = cy * cp;
+  m[6]  = -cy * sp;
+  m[7]  = extrinsics.y;
+  m[8]  = 0;
+  m[9]  = sp;
+  m[10] = cp;
+  m[11] = extrinsics.height;
+}
+
+void mmWaveTransformPoints(const float m[12], const float* __restrict x,
+                           const float* __restrict y,
+                           const float* __restrict z,
+                           float* __restrict out_x, float* __restrict out_y,
+                           float* __restrict out_z, size_t n) {
+  // Kept in registers, so the loop below vectorises on hosts
+  const float m0 = m[0], m1 = m[1], m2 = m[2], m3 = m[3];
+  const float m4 = m[4], m5 = m[5], m6 = m[6], m7 = m[7];
+  const float m8 = m[8], m9 = m[9], m10 = m[10], m11 = m[11];
+  for (size_t i = 0; i < n; i++) {
+    out_x[i] = m0 * x[i] + m1 * y[i] + m2 * z[i] + m3;
+    out_y[i] = m4 * x[i] + m5 * y[i] + m6 * z[i] + m7;
+    out_z[i] = m8 * x[i] + m9 * y[i] + m10 * z[i] + m11;
+  }
+}
+
+mmWaveFusion::mmWaveFusion() {
+  memset(_voxel_stamps, 0, sizeof(_voxel_stamps));
+  reset();
+}
+
+/**
+ * @brief Configure the fusion and forget all sensors.
+ *
+ * @param skew_ms Largest age difference between frames fused in one tick.
+ * A tick also waits up to this long for sensors that have not reported yet.
+ * @param voxel_size Edge of the deduplication voxel in metres. Of several
+ * points in one voxel, the one from the lowest sensor index is kept.
+ */
+void mmWaveFusion::begin(uint32_t skew_ms, float voxel_size) {
+  _skew_ms     = skew_ms;
+  _voxel_scale = voxel_size > 0 ? 1.0f / voxel_size : 10.0f;
+  reset();
+}
+
+void mmWaveFusion::reset() {
+  for (size_t i = 0; i < MMWAVE_FUSION_MAX_SENSORS; i++) {
+    _sensors[i].configured = false;
+    _sensors[i].pending    = false;
+    _sensors[i].num_points = 0;
+  }
+  _ticks           = 0;
+  _stale_frames    = 0;
+  _dropped_points  = 0;
+  _duplicate_count = 0;
+}
+
+bool mmWaveFusion::setSensor(uint8_t index,
+                             const mmWaveExtrinsics& extrinsics) {
+  if (index >= MMWAVE_FUSION_MAX_SENSORS)
+    return false;
+  Sensor& sensor    = _sensors[index];
+  sensor.extrinsics = extrinsics;
+  sensor.configured = true;
+  mmWaveBuildTransform(extrinsics, sensor.transform);
+  return true;
+}
+
+/**
+ * @brief Update the height of a configured sensor, e.g. with the value
+ * read back by SEEED_MR60FDA2::getRadarParameters().
+ */
+bool mmWaveFusion::setInstallationHeight(uint8_t index, float height) {
+  if (index >= MMWAVE_FUSION_MAX_SENSORS || !_sensors[index].configured)
+    return false;
+  mmWaveExtrinsics extrinsics = _sensors[index].extrinsics;
+  extrinsics.height           = height;
+  return setSensor(index, extrinsics);
+}
+
+bool mmWaveFusion::getSensor(uint8_t index,
+                             mmWaveExtrinsics& extrinsics) const {
+  if (index >= MMWAVE_FUSION_MAX_SENSORS || !_sensors[index].configured)
+    return false;
+  extrinsics = _sensors[index].extrinsics;
+  return true;
+}
+
+/**
+ * @brief Store the newest cloud of a sensor for the next tick.
+ *
+ * @param index The sensor index given to setSensor().
+ * @param timestamp_ms When the cloud was received, e.g. millis().
+ * @param cloud The cloud in sensor coordinates.
+ * @retval false The sensor is not configured.
+ */
+bool mmWaveFusion::ingest(uint8_t index, uint32_t timestamp_ms,
+                          const PeopleCounting& cloud) {
+  if (index >= MMWAVE_FUSION_MAX_SENSORS || !_sensors[index].configured)
+    return false;
+
+  Sensor& sensor = _sensors[index];
+  if (sensor.pending)
+    _stale_frames++;  // superseded before it was fused
+
+  size_t n = cloud.targets.size();
+  if (n > MMWAVE_FUSION_MAX_POINTS) {
+    _dropped_points += n - MMWAVE_FUSION_MAX_POINTS;
+    n = MMWAVE_FUSION_MAX_POINTS;
+  }
+  for (size_t i = 0; i < n; i++) {
+    const TargetN& target = cloud.targets[i];
+    sensor.x[i]           = target.x_point;
+    sensor.y[i]           = target.y_point;
+    sensor.z[i]           = target.z_point;
+    sensor.dop[i]         = target.dop_index;
+    sensor.cluster[i]     = target.cluster_index;
+  }
+  sensor.num_points   = n;
+  sensor.timestamp_ms = timestamp_ms;
+  sensor.pending      = true;
+  return true;
+}
+
+void mmWaveFusion::nextGeneration() {
+  if (++_generation == 0) {
+    memset(_voxel_stamps, 0, sizeof(_voxel_stamps));
+    _generation = 1;
+  }
+}
+
+/* Returns false if the voxel of (x, y, z) is already occupied this tick */
+bool mmWaveFusion::insertVoxel(float x, float y, float z) {
+  // 10 bits per axis, voxels alias beyond 1024 voxels per axis
+  uint32_t ix  = static_cast<int32_t>(floorf(x * _voxel_scale)) & 0x3FF;
+  uint32_t iy  = static_cast<int32_t>(floorf(y * _voxel_scale)) & 0x3FF;
+  uint32_t iz  = static_cast<int32_t>(floorf(z * _voxel_scale)) & 0x3FF;
+  uint32_t key = ix | (iy << 10) | (iz << 20);
+
+  uint32_t hash = key * 2654435761u;
+  size_t slot   = (hash ^ (hash >> 16)) & (MMWAVE_FUSION_TABLE_SIZE - 1);
+  while (_voxel_stamps[slot] == _generation) {
+    if (_voxel_keys[slot] == key)
+      return false;
+    slot = (slot + 1) & (MMWAVE_FUSION_TABLE_SIZE - 1);
+  }
+  _voxel_stamps[slot] = _generation;
+  _voxel_keys[slot]   = key;
+  return true;
+}
+
+/**
+ * @brief Merge the pending frames into one world-frame cloud.
+ *
+ * The newest pending frame is the reference; pending frames older than it
+ * by more than the skew are discarded as stale. While a configured sensor
+ * has not reported, the tick waits for it until the oldest pending frame is
+ * `skew_ms` old.
+ *
+ * @param now The current time, on the clock given to ingest().
+ * @param merged The fused cloud, cluster indices are those of each sensor.
+ * @retval true A cloud was emitted.
+ * @retval false Nothing to emit yet.
+ */
+bool mmWaveFusion::tick(uint32_t now, PeopleCounting& merged) {
+  bool any         = false;
+  bool missing     = false;
+  uint32_t oldest  = 0;
+  uint32_t newest  = 0;
+  for (size_t i = 0; i < MMWAVE_FUSION_MAX_SENSORS; i++) {
+    const Sensor& sensor = _sensors[i];
+    if (!sensor.configured)
+      continue;
+    if (!sensor.pending) {
+      missing = true;
+      continue;
+    }
+    if (!any || static_cast<int32_t>(oldest - sensor.timestamp_ms) > 0)
+      oldest = sensor.timestamp_ms;
+    if (!any || static_cast<int32_t>(sensor.timestamp_ms - newest) > 0)
+      newest = sensor.timestamp_ms;
+    any = true;
+  }
+  if (!any || (missing && now - oldest < _skew_ms))
+    return false;
+
+  merged.targets.clear();
+  merged.targets.reserve(kMaxFused);
+  nextGeneration();
+
+  for (size_t i = 0; i < MMWAVE_FUSION_MAX_SENSORS; i++) {
+    Sensor& sensor = _sensors[i];
+    if (!sensor.configured || !sensor.pending)
+      continue;
+    sensor.pending = false;
+    if (newest - sensor.timestamp_ms > _skew_ms) {
+      _stale_frames++;
+      continue;
+    }
+
+    mmWaveTransformPoints(sensor.transform, sensor.x, sensor.y, sensor.z,
+                          _world_x, _world_y, _world_z, sensor.num_points);
+    for (size_t p = 0; p < sensor.num_points; p++) {
+      if (!insertVoxel(_world_x[p], _world_y[p], _world_z[p])) {
+        _duplicate_count++;
+        continue;
+      }
+      TargetN target;
+      target.x_point       = _world_x[p];
+      target.y_point       = _world_y[p];
+      target.z_point       = _world_z[p];
+      target.dop_index     = sensor.dop[p];
+      target.cluster_index = sensor.cluster[p];
+      merged.targets.push_back(target);
+    }
+  }
+  _ticks++;
+  return true;
+}
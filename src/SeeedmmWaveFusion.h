@@ -0,0 +1,140 @@
+/**
+ * @file SeeedmmWaveFusion.h
+ * @date  18 October 2026
+ *
+ * @note Point-cloud fusion of several radars into one world frame.
+ *
+ * @copyright © 2024, Seeed Studio
+ *
+ * @attention Each sensor is described by its extrinsics. Clouds are
+ * ingested with the time they were received; a tick merges the newest frame
+ * of every sensor that lies within the configured skew, transforms the
+ * points into the world frame and removes points that fall into the same
+ * voxel. All buffers are fixed, a tick does not allocate once the output
+ * vector has grown to its working size.
+ */
+
+#ifndef SEEEDMMWAVE_FUSION_H
+#define SEEEDMMWAVE_FUSION_H
+
+#include "SEEED_Public.h"
+
+#ifndef MMWAVE_FUSION_MAX_SENSORS
+#  define MMWAVE_FUSION_MAX_SENSORS 3
+#endif
+
+/* Points kept per sensor frame, extra points are counted but not fused. */
+#ifndef MMWAVE_FUSION_MAX_POINTS
+#  define MMWAVE_FUSION_MAX_POINTS 64
+#endif
+
+/* Voxel hash slots, a power of two above the number of fused points. */
+#ifndef MMWAVE_FUSION_TABLE_SIZE
+#  define MMWAVE_FUSION_TABLE_SIZE 512
+#endif
+
+/**
+ * @brief Pose of a sensor in the world frame.
+ *
+ * At zero yaw and pitch the sensor axes are the world axes, z pointing up.
+ * The sensor is pitched about its x axis, then yawed about the world z axis,
+ * then moved to (x, y, height). Use a height of 0 if the sensor already
+ * reports heights above the floor.
+ */
+typedef struct mmWaveExtrinsics {
+  float x;       // m
+  float y;       // m
+  float height;  // m, as given to setInstallationHeight()
+  float yaw;     // rad, counter-clockwise seen from above
+  float pitch;   // rad, positive tilts the sensor y axis upwards
+} mmWaveExtrinsics;
+
+/**
+ * @brief Build the row-major 3x4 sensor-to-world matrix [R | t].
+ */
+void mmWaveBuildTransform(const mmWaveExtrinsics& extrinsics, float m[12]);
+
+/**
+ * @brief Transform `n` points given as column arrays. The output arrays
+ * must not overlap the inputs.
+ */
+void mmWaveTransformPoints(const float m[12], const float* x, const float* y,
+                           const float* z, float* out_x, float* out_y,
+                           float* out_z, size_t n);
+
+class mmWaveFusion {
+ private:
+  struct Sensor {
+    float transform[12];
+    mmWaveExtrinsics extrinsics;
+    bool configured;
+    bool pending;  // a frame arrived since the last tick
+    uint32_t timestamp_ms;
+    uint16_t num_points;
+    float x[MMWAVE_FUSION_MAX_POINTS];
+    float y[MMWAVE_FUSION_MAX_POINTS];
+    float z[MMWAVE_FUSION_MAX_POINTS];
+    float dop[MMWAVE_FUSION_MAX_POINTS];
+    int32_t cluster[MMWAVE_FUSION_MAX_POINTS];
+  };
+
+  static const size_t kMaxFused =
+      MMWAVE_FUSION_MAX_SENSORS * MMWAVE_FUSION_MAX_POINTS;
+  static_assert((MMWAVE_FUSION_TABLE_SIZE &
+                 (MMWAVE_FUSION_TABLE_SIZE - 1)) == 0,
+                "MMWAVE_FUSION_TABLE_SIZE must be a power of two");
+  static_assert(MMWAVE_FUSION_TABLE_SIZE > kMaxFused,
+                "MMWAVE_FUSION_TABLE_SIZE must exceed the fused points");
+
+  Sensor _sensors[MMWAVE_FUSION_MAX_SENSORS];
+
+  /* World coordinates of one sensor frame */
+  float _world_x[MMWAVE_FUSION_MAX_POINTS];
+  float _world_y[MMWAVE_FUSION_MAX_POINTS];
+  float _world_z[MMWAVE_FUSION_MAX_POINTS];
+
+  /* Occupied voxels of the current tick, valid where stamp == generation */
+  uint32_t _voxel_keys[MMWAVE_FUSION_TABLE_SIZE];
+  uint16_t _voxel_stamps[MMWAVE_FUSION_TABLE_SIZE];
+  uint16_t _generation = 0;
+
+  uint32_t _skew_ms   = 50;
+  float _voxel_scale  = 10.0f;  // 1 / voxel size
+
+  uint32_t _ticks           = 0;
+  uint32_t _stale_frames    = 0;
+  uint32_t _dropped_points  = 0;
+  uint32_t _duplicate_count = 0;
+
+  void nextGeneration();
+  bool insertVoxel(float x, float y, float z);
+
+ public:
+  mmWaveFusion();
+
+  void begin(uint32_t skew_ms = 50, float voxel_size = 0.1f);
+  void reset();
+
+  bool setSensor(uint8_t index, const mmWaveExtrinsics& extrinsics);
+  bool setInstallationHeight(uint8_t index, float height);
+  bool getSensor(uint8_t index, mmWaveExtrinsics& extrinsics) const;
+
+  bool ingest(uint8_t index, uint32_t timestamp_ms,
+              const PeopleCounting& cloud);
+  bool tick(uint32_t now, PeopleCounting& merged);
+
+  uint32_t ticks() const {
+    return _ticks;
+  }
+  uint32_t staleFrames() const {
+    return _stale_frames;
+  }
+  uint32_t droppedPoints() const {
+    return _dropped_points;
+  }
+  uint32_t duplicatePoints() const {
+    return _duplicate_count;
+  }
+};
+
+#endif /*SEEEDMMWAVE_FUSION_H*/
@@ -0,0 +1,240 @@
+/**
+ * @file SeeedmmWaveHistory.cpp
+ * @date  18 October 2026
+ *
+ * @note Rolling store of recent point clouds, searchable by place and time.
+ *
+ * @copyright © 2024, Seeed Studio
+ */
+
+#include "SeeedmmWaveHistory.h"
+
+#include <math.h>
+#include <string.h>
+
+/* End of a chain */
+#define MMWAVE_HISTORY_NONE 0xFFFF
+
+/* Cell coordinates are clamped to +-2^20 cells */
+#define MMWAVE_HISTORY_COORD_MAX 1048576
+
+bool mmWaveHistory::begin(size_t max_points, uint32_t slice_ms,
+                          uint8_t slices, float cell_size) {
+  if (max_points == 0 || max_points >= MMWAVE_HISTORY_NONE || slice_ms == 0 ||
+      slices < 2 || !(cell_size > 0) ||
+      static_cast<uint64_t>(slice_ms) * slices >= 0x80000000u)
+    return false;
+  _entries.assign(max_points, Entry());
+  _slices.assign(slices, Slice());
+  _heads.assign(static_cast<size_t>(slices) * MMWAVE_HISTORY_BUCKETS,
+                MMWAVE_HISTORY_NONE);
+  _slice_ms     = slice_ms;
+  _inverse_cell = 1.0f / cell_size;
+  clear();
+  return true;
+}
+
+void mmWaveHistory::clear() {
+  _oldest_entry = 0;
+  _entry_count  = 0;
+  _oldest_slice = 0;
+  _slice_count  = 0;
+  _dropped      = 0;
+}
+
+int32_t mmWaveHistory::cellOf(float position) const {
+  float cell = floorf(position * _inverse_cell);
+  if (!(cell >= -MMWAVE_HISTORY_COORD_MAX))  // also NaN
+    return -MMWAVE_HISTORY_COORD_MAX;
+  if (cell > MMWAVE_HISTORY_COORD_MAX)
+    return MMWAVE_HISTORY_COORD_MAX;
+  return static_cast<int32_t>(cell);
+}
+
+uint32_t mmWaveHistory::bucketOf(int32_t x, int32_t y, int32_t z) {
+  return (static_cast<uint32_t>(x) * 73856093u ^
+          static_cast<uint32_t>(y) * 19349663u ^
+          static_cast<uint32_t>(z) * 83492791u) &
+         (MMWAVE_HISTORY_BUCKETS - 1);
+}
+
+void mmWaveHistory::openSlice(uint32_t timestamp_ms) {
+  if (_slice_count == _slices.size())
+    dropSlice();
+  size_t index   = (_oldest_slice + _slice_count++) % _slices.size();
+  Slice& slice   = _slices[index];
+  slice.start_ms = timestamp_ms;
+  slice.end_ms   = timestamp_ms;
+  slice.count    = 0;
+  memset(&_heads[index * MMWAVE_HISTORY_BUCKETS], 0xFF,
+         MMWAVE_HISTORY_BUCKETS * sizeof(uint16_t));
+}
+
+/* The chains of a dropped slice are never read again, nothing to unlink */
+void mmWaveHistory::dropSlice() {
+  const Slice& slice = _slices[_oldest_slice];
+  _oldest_entry      = (_oldest_entry + slice.count) % _entries.size();
+  _entry_count -= slice.count;
+  _oldest_slice = (_oldest_slice + 1) % _slices.size();
+  _slice_count--;
+}
+
+void mmWaveHistory::expire(uint32_t before_ms) {
+  while (_slice_count > 0 &&
+         static_cast<int32_t>(_slices[_oldest_slice].end_ms - before_ms) < 0) {
+    dropSlice();
+  }
+}
+
+size_t mmWaveHistory::add(uint32_t timestamp_ms, const PeopleCounting& cloud) {
+  if (_entries.empty())
+    return 0;
+
+  // History covers `slices` slice lengths at most
+  size_t slices = _slices.size();
+  expire(timestamp_ms - static_cast<uint32_t>(slices) * _slice_ms);
+
+  size_t current = (_oldest_slice + _slice_count - 1) % slices;
+  if (_slice_count == 0 ||
+      timestamp_ms - _slices[current].start_ms >= _slice_ms) {
+    openSlice(timestamp_ms);
+    current = (_oldest_slice + _slice_count - 1) % slices;
+  }
+  Slice& slice    = _slices[current];
+  slice.end_ms    = timestamp_ms;
+  uint16_t* heads = &_heads[current * MMWAVE_HISTORY_BUCKETS];
+
+  size_t stored = 0;
+  for (const TargetN& target : cloud.targets) {
+    // Make room by dropping the oldest slices, never the current one. Slices
+    // of empty clouds free nothing, so keep going until an entry is free.
+    while (_entry_count == _entries.size() && _slice_count > 1) {
+      dropSlice();
+    }
+    if (_entry_count == _entries.size()) {
+      _dropped += cloud.targets.size() - stored;
+      break;
+    }
+    uint16_t index = (_oldest_entry + _entry_count) % _entries.size();
+    Entry& entry   = _entries[index];
+
+    entry.point.x_point       = target.x_point;
+    entry.point.y_point       = target.y_point;
+    entry.point.z_point       = target.z_point;
+    entry.point.dop_index     = target.dop_index;
+    entry.point.cluster_index = target.cluster_index;
+    entry.point.timestamp_ms  = timestamp_ms;
+    uint32_t bucket = bucketOf(cellOf(target.x_point), cellOf(target.y_point),
+                               cellOf(target.z_point));
+    entry.next    = heads[bucket];
+    heads[bucket] = index;
+    _entry_count++;
+    slice.count++;
+    stored++;
+  }
+  return stored;
+}
+
+uint32_t mmWaveHistory::oldestMs() const {
+  return _slice_count ? _slices[_oldest_slice].start_ms : 0;
+}
+
+size_t mmWaveHistory::radius(float x, float y, float z, float radius,
+                             uint32_t from_ms, uint32_t to_ms,
+                             mmWaveHistoryVisitor visitor,
+                             void* context) const {
+  if (!(radius >= 0))
+    return 0;
+  mmWaveRoiBox bounds   = {x - radius, x + radius, y - radius,
+                           y + radius, z - radius, z + radius};
+  const float center[3] = {x, y, z};
+  return query(bounds, center, radius, from_ms, to_ms, visitor, context);
+}
+
+size_t mmWaveHistory::box(const mmWaveRoiBox& box, uint32_t from_ms,
+                          uint32_t to_ms, mmWaveHistoryVisitor visitor,
+                          void* context) const {
+  return query(box, nullptr, 0, from_ms, to_ms, visitor, context);
+}
+
+/**
+ * @brief Visit the points in `box`, or with `center` in the sphere it
+ * bounds. Two cells may share a bucket, so the buckets are collected once,
+ * and every point of their chains is tested against the box or the sphere.
+ */
+size_t mmWaveHistory::query(const mmWaveRoiBox& box, const float* center,
+                            float radius, uint32_t from_ms, uint32_t to_ms,
+                            mmWaveHistoryVisitor visitor,
+                            void* context) const {
+  if (_slice_count == 0)
+    return 0;
+
+  int32_t lo[3] = {cellOf(box.x_min), cellOf(box.y_min), cellOf(box.z_min)};
+  int32_t hi[3] = {cellOf(box.x_max), cellOf(box.y_max), cellOf(box.z_max)};
+  float cells   = 1;
+  for (size_t axis = 0; axis < 3; axis++) {
+    if (hi[axis] < lo[axis])
+      return 0;
+    cells *= static_cast<float>(hi[axis] - lo[axis] + 1);
+  }
+
+  uint16_t buckets[MMWAVE_HISTORY_BUCKETS];
+  size_t bucket_count = 0;
+  if (cells >= MMWAVE_HISTORY_BUCKETS) {
+    for (size_t b = 0; b < MMWAVE_HISTORY_BUCKETS; b++) {
+      buckets[bucket_count++] = b;
+    }
+  } else {
+    uint32_t seen[MMWAVE_HISTORY_BUCKETS / 32 + 1] = {0};
+    for (int32_t cx = lo[0]; cx <= hi[0]; cx++) {
+      for (int32_t cy = lo[1]; cy <= hi[1]; cy++) {
+        for (int32_t cz = lo[2]; cz <= hi[2]; cz++) {
+          uint32_t b = bucketOf(cx, cy, cz);
+          if (seen[b / 32] & (1u << (b % 32)))
+            continue;
+          seen[b / 32] |= 1u << (b % 32);
+          buckets[bucket_count++] = b;
+        }
+      }
+    }
+  }
+
+  float radius2 = radius * radius;
+  size_t found  = 0;
+  for (size_t s = 0; s < _slice_count; s++) {
+    size_t index       = (_oldest_slice + s) % _slices.size();
+    const Slice& slice = _slices[index];
+    // Signed, timestamps may wrap
+    if (static_cast<int32_t>(to_ms - slice.start_ms) < 0 ||
+        static_cast<int32_t>(slice.end_ms - from_ms) < 0)
+      continue;
+    bool whole = static_cast<int32_t>(slice.start_ms - from_ms) >= 0 &&
+                 static_cast<int32_t>(to_ms - slice.end_ms) >= 0;
+    const uint16_t* heads = &_heads[index * MMWAVE_HISTORY_BUCKETS];
+    for (size_t b = 0; b < bucket_count; b++) {
+      for (uint16_t e = heads[buckets[b]]; e != MMWAVE_HISTORY_NONE;
+           e = _entries[e].next) {
+        const mmWaveHistoryPoint& point = _entries[e].point;
+        if (!whole &&
+            (static_cast<int32_t>(point.timestamp_ms - from_ms) < 0 ||
+             static_cast<int32_t>(to_ms - point.timestamp_ms) < 0))
+          continue;
+        if (center) {
+          float dx = point.x_point - center[0];
+          float dy = point.y_point - center[1];
+          float dz = point.z_point - center[2];
+          if (dx * dx + dy * dy + dz * dz > radius2)
+            continue;
+        } else if (point.x_point < box.x_min || point.x_point > box.x_max ||
+                   point.y_point < box.y_min || point.y_point > box.y_max ||
+                   point.z_point < box.z_min || point.z_point > box.z_max) {
+          continue;
+        }
+        found++;
+        if (visitor && !visitor(point, context))
+          return found;
+      }
+    }
+  }
+  return found;
+}
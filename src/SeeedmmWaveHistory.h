@@ -0,0 +1,162 @@
+/**
+ * @file SeeedmmWaveHistory.h
+ * @date  18 October 2026
+ *
+ * @note Rolling store of recent point clouds, searchable by place and time.
+ *
+ * @copyright © 2024, Seeed Studio
+ *
+ * @attention Points are kept in one ring of `max_points` entries, in the
+ * order they came in, cut into time slices of `slice_ms`. Each slice has
+ * its own hash table of MMWAVE_HISTORY_BUCKETS chains, one per group of
+ * cubic cells of `cell_size`, threaded through the points. History is
+ * dropped a whole slice at a time, the oldest first: when the ring is full,
+ * when all `slices` slices are in use, or when a slice is older than
+ * `slices` * `slice_ms`. Dropping a slice moves two indices, whatever the
+ * number of points in it, and nothing is ever allocated after begin().
+ *
+ * A query visits only the slices overlapping its time window, and in each
+ * of them only the chains of the cells its sphere or box touches, so its
+ * cost follows the number of points near the place asked about rather than
+ * the length of the history. Points are visited slice by slice, the oldest
+ * first; within a slice the order is unspecified. Timestamps are expected
+ * not to go backwards; they may wrap around.
+ *
+ * @code
+ * mmWaveHistory history;
+ * history.begin(4096, 1000, 32, 0.25f);  // about 32 s
+ * ...
+ * if (mmWave.getPeopleCountingPointCloud(cloud))
+ *   history.add(millis(), cloud);
+ * // points within 0.5 m of the bed in the last 30 s
+ * size_t n = history.radius(bed_x, bed_y, 0.5f, 0.5f, millis() - 30000,
+ *                           millis());
+ * @endcode
+ */
+
+#ifndef SEEEDMMWAVE_HISTORY_H
+#define SEEEDMMWAVE_HISTORY_H
+
+#include "SEEED_Public.h"
+#include "SeeedmmWaveRoi.h"
+
+/* Chains per slice, a power of two, 2 bytes each */
+#ifndef MMWAVE_HISTORY_BUCKETS
+#  define MMWAVE_HISTORY_BUCKETS 256
+#endif
+
+static_assert((MMWAVE_HISTORY_BUCKETS & (MMWAVE_HISTORY_BUCKETS - 1)) == 0,
+              "MMWAVE_HISTORY_BUCKETS must be a power of two");
+
+typedef struct mmWaveHistoryPoint {
+  float x_point;
+  float y_point;
+  float z_point;
+  float dop_index;
+  int32_t cluster_index;
+  uint32_t timestamp_ms;  // of the cloud it came with
+} mmWaveHistoryPoint;
+
+/**
+ * @brief Called for every point a query finds.
+ *
+ * @return false to end the query.
+ */
+typedef bool (*mmWaveHistoryVisitor)(const mmWaveHistoryPoint& point,
+                                     void* context);
+
+class mmWaveHistory {
+ private:
+  struct Entry {
+    mmWaveHistoryPoint point;
+    uint16_t next;  // in the chain of its bucket
+  };
+
+  struct Slice {
+    uint32_t start_ms;  // first cloud
+    uint32_t end_ms;    // last cloud
+    uint16_t count;     // entries, they follow those of the slice before
+  };
+
+  std::vector<Entry> _entries;
+  std::vector<Slice> _slices;
+  std::vector<uint16_t> _heads;  // MMWAVE_HISTORY_BUCKETS per slice
+
+  uint16_t _oldest_entry = 0;
+  uint16_t _entry_count  = 0;
+  uint8_t _oldest_slice  = 0;
+  uint8_t _slice_count   = 0;
+
+  uint32_t _slice_ms  = 1000;
+  float _inverse_cell = 4;
+  uint32_t _dropped   = 0;
+
+  int32_t cellOf(float position) const;
+  static uint32_t bucketOf(int32_t x, int32_t y, int32_t z);
+  void openSlice(uint32_t timestamp_ms);
+  void dropSlice();
+  size_t query(const mmWaveRoiBox& box, const float* center, float radius,
+               uint32_t from_ms, uint32_t to_ms, mmWaveHistoryVisitor visitor,
+               void* context) const;
+
+ public:
+  mmWaveHistory() {}
+
+  /**
+   * @param max_points Points kept at most, up to 65535.
+   * @param slice_ms Time covered by a slice, the unit of expiry; history
+   * spans `slices` * `slice_ms` at most, below 2^31 ms.
+   * @param slices Slices kept at most, 2 to 255.
+   * @param cell_size Edge of a spatial cell in metres, about the radius of
+   * the typical query.
+   * @retval false An argument is out of range.
+   */
+  bool begin(size_t max_points, uint32_t slice_ms = 1000, uint8_t slices = 32,
+             float cell_size = 0.25f);
+
+  /* Forget every point */
+  void clear();
+
+  /**
+   * @brief Store the points of a cloud.
+   *
+   * @param timestamp_ms When the cloud was received, usually millis().
+   * @return The number of points stored, fewer if the current slice alone
+   * fills the ring.
+   */
+  size_t add(uint32_t timestamp_ms, const PeopleCounting& cloud);
+
+  /* Drop the slices that ended before `before_ms` */
+  void expire(uint32_t before_ms);
+
+  /**
+   * @brief Visit the points within `radius` of (x, y, z) received from
+   * `from_ms` to `to_ms`, both included.
+   *
+   * @param visitor Called for each point, nullptr to count only.
+   * @return The number of points visited.
+   */
+  size_t radius(float x, float y, float z, float radius, uint32_t from_ms,
+                uint32_t to_ms, mmWaveHistoryVisitor visitor = nullptr,
+                void* context = nullptr) const;
+
+  /* Same for the points in a box, its borders included */
+  size_t box(const mmWaveRoiBox& box, uint32_t from_ms, uint32_t to_ms,
+             mmWaveHistoryVisitor visitor = nullptr,
+             void* context = nullptr) const;
+
+  size_t size() const {
+    return _entry_count;
+  }
+  size_t sliceCount() const {
+    return _slice_count;
+  }
+  /* First cloud still kept, meaningless while empty */
+  uint32_t oldestMs() const;
+  /* Points not stored because the current slice filled the ring */
+  uint32_t dropped() const {
+    return _dropped;
+  }
+};
+
+#endif /*SEEEDMMWAVE_HISTORY_H*/
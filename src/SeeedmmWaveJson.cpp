@@ -0,0 +1,255 @@
+/**
+ * @file SeeedmmWaveJson.cpp
+ * @date  18 October 2026
+ *
+ * @note Streaming JSON writer for telemetry output.
+ *
+ * @copyright © 2024, Seeed Studio
+ */
+
+#include "SeeedmmWaveJson.h"
+
+#include <math.h>
+#include <string.h>
+
+static const uint32_t kPow10[] = {1,      10,      100,      1000,     10000,
+                                  100000, 1000000, 10000000, 100000000};
+
+void mmWaveJsonWriter::clear() {
+  _length    = 0;
+  _depth     = 0;
+  _filled    = 0;
+  _after_key = false;
+  _overflow  = false;
+}
+
+void mmWaveJsonWriter::put(char c) {
+  if (_length < _capacity)
+    _buffer[_length++] = c;
+  else
+    _overflow = true;
+}
+
+void mmWaveJsonWriter::put(const char* text, size_t len) {
+  if (len > _capacity - _length) {
+    len       = _capacity - _length;
+    _overflow = true;
+  }
+  memcpy(_buffer + _length, text, len);
+  _length += len;
+}
+
+void mmWaveJsonWriter::putUnsigned(uint32_t value, uint8_t min_digits) {
+  char digits[10];
+  uint8_t n = 0;
+  while (value != 0 || n < min_digits) {
+    digits[sizeof(digits) - 1 - n++] = '0' + value % 10;
+    value /= 10;
+  }
+  put(digits + sizeof(digits) - n, n);
+}
+
+/* Comma before every member or element but the first of its container */
+void mmWaveJsonWriter::separate() {
+  if (_after_key) {
+    _after_key = false;
+    return;
+  }
+  uint32_t bit = 1UL << _depth;
+  if (_filled & bit)
+    put(',');
+  _filled |= bit;
+}
+
+void mmWaveJsonWriter::open(char bracket) {
+  separate();
+  put(bracket);
+  if (_depth + 1 < MMWAVE_JSON_MAX_DEPTH) {
+    _depth++;
+    _filled &= ~(1UL << _depth);
+  } else {
+    _overflow = true;
+  }
+}
+
+void mmWaveJsonWriter::close(char bracket) {
+  put(bracket);
+  if (_depth > 0)
+    _depth--;
+}
+
+mmWaveJsonWriter& mmWaveJsonWriter::beginObject() {
+  open('{');
+  return *this;
+}
+
+mmWaveJsonWriter& mmWaveJsonWriter::endObject() {
+  close('}');
+  return *this;
+}
+
+mmWaveJsonWriter& mmWaveJsonWriter::beginArray() {
+  open('[');
+  return *this;
+}
+
+mmWaveJsonWriter& mmWaveJsonWriter::endArray() {
+  close(']');
+  return *this;
+}
+
+mmWaveJsonWriter& mmWaveJsonWriter::key(const char* name) {
+  value(name);
+  put(':');
+  _after_key = true;
+  return *this;
+}
+
+/**
+ * @brief Write a string, escaping quotes, backslashes and control
+ * characters.
+ */
+mmWaveJsonWriter& mmWaveJsonWriter::value(const char* text) {
+  static const char kHex[] = "0123456789abcdef";
+  separate();
+  put('"');
+  const char* run = text;  // characters that need no escaping
+  for (; *text; text++) {
+    uint8_t c = *text;
+    if (c >= 0x20 && c != '"' && c != '\\')
+      continue;
+    put(run, text - run);
+    put('\\');
+    switch (c) {
+      case '"':
+      case '\\':
+        put(c);
+        break;
+      case '\n':
+        put('n');
+        break;
+      case '\r':
+        put('r');
+        break;
+      case '\t':
+        put('t');
+        break;
+      default:
+        put("u00", 3);
+        put(kHex[c >> 4]);
+        put(kHex[c & 0xF]);
+        break;
+    }
+    run = text + 1;
+  }
+  put(run, text - run);
+  put('"');
+  return *this;
+}
+
+mmWaveJsonWriter& mmWaveJsonWriter::value(bool flag) {
+  separate();
+  if (flag)
+    put("true", 4);
+  else
+    put("false", 5);
+  return *this;
+}
+
+mmWaveJsonWriter& mmWaveJsonWriter::value(int32_t number) {
+  separate();
+  uint32_t magnitude = number;
+  if (number < 0) {
+    put('-');
+    magnitude = 0U - magnitude;
+  }
+  putUnsigned(magnitude);
+  return *this;
+}
+
+mmWaveJsonWriter& mmWaveJsonWriter::value(uint32_t number) {
+  separate();
+  putUnsigned(number);
+  return *this;
+}
+
+/**
+ * @brief Write a float rounded to a fixed number of decimals. Only the
+ * split into whole and fraction is done in float, the digits are produced
+ * in integer arithmetic.
+ *
+ * @param number NaN, infinities and magnitudes of 4e9 and above have no
+ * fixed-point form here and are written as null.
+ * @param decimals 0 to 8.
+ */
+mmWaveJsonWriter& mmWaveJsonWriter::value(float number, uint8_t decimals) {
+  float magnitude = fabsf(number);
+  if (!(magnitude < 4e9f))
+    return null();
+  if (decimals > 8)
+    decimals = 8;
+
+  separate();
+  uint32_t whole    = static_cast<uint32_t>(magnitude);
+  uint32_t fraction = static_cast<uint32_t>(
+      (magnitude - static_cast<float>(whole)) * kPow10[decimals] + 0.5f);
+  if (fraction >= kPow10[decimals]) {
+    whole++;
+    fraction -= kPow10[decimals];
+  }
+  if (number < 0 && (whole | fraction) != 0)
+    put('-');
+  putUnsigned(whole);
+  if (decimals > 0) {
+    put('.');
+    putUnsigned(fraction, decimals);
+  }
+  return *this;
+}
+
+mmWaveJsonWriter& mmWaveJsonWriter::null() {
+  separate();
+  put("null", 4);
+  return *this;
+}
+
+mmWaveJsonWriter& mmWaveJsonWriter::newline() {
+  put('\n');
+  _filled &= ~1UL;  // the next report starts without a comma
+  return *this;
+}
+
+void mmWaveJsonWrite(mmWaveJsonWriter& json, const PeopleCounting& cloud,
+                     uint32_t timestamp) {
+  json.beginObject().member("timestamp", timestamp).key("targets");
+  json.beginArray();
+  for (size_t i = 0; i < cloud.targets.size(); i++) {
+    const TargetN& target = cloud.targets[i];
+    json.beginObject()
+        .member("target_id", static_cast<uint32_t>(i + 1))
+        .member("x_point", target.x_point, 2)
+        .member("y_point", target.y_point, 2)
+        .member("z_point", target.z_point, 2)
+        .member("dop_index", target.dop_index, 6)
+        .member("cluster_index", target.cluster_index)
+        .member("move_speed", target.dop_index * 100, 2)
+        .endObject();
+  }
+  json.endArray().endObject();
+}
+
+void mmWaveJsonWrite(mmWaveJsonWriter& json, const HeartBreath& phases) {
+  json.beginObject()
+      .member("total_phase", phases.total_phase, 3)
+      .member("breath_phase", phases.breath_phase, 3)
+      .member("heart_phase", phases.heart_phase, 3)
+      .endObject();
+}
+
+void mmWaveJsonWriteFallState(mmWaveJsonWriter& json, bool is_fall,
+                              bool is_human) {
+  json.beginObject()
+      .member("is_fall", is_fall)
+      .member("is_human", is_human)
+      .endObject();
+}
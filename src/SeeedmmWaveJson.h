@@ -0,0 +1,106 @@
+/**
+ * @file SeeedmmWaveJson.h
+ * @date  18 October 2026
+ *
+ * @note Streaming JSON writer for telemetry output.
+ *
+ * @copyright © 2024, Seeed Studio
+ *
+ * @attention The writer fills a caller supplied buffer, so a whole report
+ * is sent with one write(). Floats are formatted with a fixed number of
+ * decimals in integer arithmetic, without printf. Commas between members
+ * and elements are inserted by the writer. This header does not depend on
+ * Arduino.
+ *
+ * @code
+ * char buffer[2048];
+ * mmWaveJsonWriter json(buffer, sizeof(buffer));
+ * mmWaveJsonWrite(json, point_cloud, millis());
+ * json.newline();
+ * if (!json.overflow())
+ *   Serial.write(json.data(), json.size());
+ * @endcode
+ */
+
+#ifndef SEEEDMMWAVE_JSON_H
+#define SEEEDMMWAVE_JSON_H
+
+#include "SEEED_Public.h"
+
+/* Nesting depth of objects and arrays */
+#define MMWAVE_JSON_MAX_DEPTH 32
+
+class mmWaveJsonWriter {
+ private:
+  char* _buffer;
+  size_t _capacity;
+  size_t _length   = 0;
+  uint8_t _depth   = 0;
+  uint32_t _filled = 0;  // bit n: the container at depth n has a member
+  bool _after_key  = false;
+  bool _overflow   = false;
+
+  void put(char c);
+  void put(const char* text, size_t len);
+  void putUnsigned(uint32_t value, uint8_t min_digits = 1);
+  void separate();
+  void open(char bracket);
+  void close(char bracket);
+
+ public:
+  mmWaveJsonWriter(char* buffer, size_t capacity)
+      : _buffer(buffer), _capacity(capacity) {}
+
+  void clear();
+
+  mmWaveJsonWriter& beginObject();
+  mmWaveJsonWriter& endObject();
+  mmWaveJsonWriter& beginArray();
+  mmWaveJsonWriter& endArray();
+  mmWaveJsonWriter& key(const char* name);
+
+  mmWaveJsonWriter& value(const char* text);
+  mmWaveJsonWriter& value(bool flag);
+  mmWaveJsonWriter& value(int32_t number);
+  mmWaveJsonWriter& value(uint32_t number);
+  mmWaveJsonWriter& value(float number, uint8_t decimals = 2);
+  mmWaveJsonWriter& null();
+
+  /* A line break between reports, only valid at the top level */
+  mmWaveJsonWriter& newline();
+
+  /* Shorthands for key(name).value(...) */
+  template <class T>
+  mmWaveJsonWriter& member(const char* name, T number) {
+    return key(name).value(number);
+  }
+  mmWaveJsonWriter& member(const char* name, float number, uint8_t decimals) {
+    return key(name).value(number, decimals);
+  }
+
+  const uint8_t* data() const {
+    return reinterpret_cast<const uint8_t*>(_buffer);
+  }
+  size_t size() const {
+    return _length;
+  }
+  /* Output was truncated, the buffer does not hold valid JSON */
+  bool overflow() const {
+    return _overflow;
+  }
+};
+
+/**
+ * @brief Serializers for the reports of the sensors, each writes one object.
+ *
+ * The point cloud uses the keys of the PointCloudChart demo:
+ * {"timestamp": ms, "targets": [{"target_id", "x_point", "y_point",
+ * "z_point", "dop_index", "cluster_index", "move_speed"}, ...]}.
+ */
+void mmWaveJsonWrite(mmWaveJsonWriter& json, const PeopleCounting& cloud,
+                     uint32_t timestamp);
+void mmWaveJsonWrite(mmWaveJsonWriter& json, const HeartBreath& phases);
+void mmWaveJsonWriteFallState(mmWaveJsonWriter& json, bool is_fall,
+                              bool is_human);
+
+#endif /*SEEEDMMWAVE_JSON_H*/
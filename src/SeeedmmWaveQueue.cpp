@@ -0,0 +1,138 @@
+/**
+ * @file SeeedmmWaveQueue.cpp
+ * @date  18 October 2026
+ *
+ * @note Received-frame queue with one bounded FIFO per priority lane.
+ *
+ * @copyright © 2024, Seeed Studio
+ */
+
+#include "SeeedmmWaveQueue.h"
+
+static const size_t kLaneCapacity[MMWAVE_LANE_COUNT] = {
+    MMWAVE_LANE_ALARM_SIZE,
+    MMWAVE_LANE_ACK_SIZE,
+    MMWAVE_LANE_STATE_SIZE,
+    MMWAVE_LANE_BULK_SIZE,
+};
+
+void mmWaveFrameQueue::clear() {
+  for (size_t i = 0; i < MMWAVE_LANE_COUNT; i++) {
+    Lane& lane    = _lanes[i];
+    lane.head_seq = 0;
+    lane.dropped  = 0;
+#if MMWAVE_STATIC_MEMORY
+    lane.first = 0;
+    lane.count = 0;
+#else
+    lane.frames.clear();
+#endif
+  }
+#if MMWAVE_STATIC_MEMORY
+  for (size_t i = 0; i < MMWAVE_STATIC_FRAME_SLOTS; i++) {
+    _free[i] = MMWAVE_STATIC_FRAME_SLOTS - 1 - i;
+  }
+  _free_count = MMWAVE_STATIC_FRAME_SLOTS;
+#endif
+}
+
+size_t mmWaveFrameQueue::size(uint8_t lane) const {
+#if MMWAVE_STATIC_MEMORY
+  return _lanes[lane].count;
+#else
+  return _lanes[lane].frames.size();
+#endif
+}
+
+size_t mmWaveFrameQueue::size() const {
+  size_t total = 0;
+  for (uint8_t i = 0; i < MMWAVE_LANE_COUNT; i++) {
+    total += size(i);
+  }
+  return total;
+}
+
+void mmWaveFrameQueue::pop(uint8_t lane) {
+  Lane& l = _lanes[lane];
+  if (size(lane) == 0)
+    return;
+#if MMWAVE_STATIC_MEMORY
+  _free[_free_count++] = slotOf(l, 0);
+  l.first              = (l.first + 1) % MMWAVE_STATIC_FRAME_SLOTS;
+  l.count--;
+#else
+  l.frames.pop_front();
+#endif
+  l.head_seq++;
+}
+
+void mmWaveFrameQueue::dropOldest(uint8_t lane) {
+  pop(lane);
+  _lanes[lane].dropped++;
+}
+
+/**
+ * @brief Append a frame to a lane. When the lane is full its oldest frame
+ * is dropped; with MMWAVE_STATIC_MEMORY, when every slot is in use the
+ * oldest frame of the lowest priority lane is dropped.
+ *
+ * @return false if the frame is larger than MMWAVE_MAX_FRAME_SIZE.
+ */
+bool mmWaveFrameQueue::push(uint8_t lane, const uint8_t* frame, size_t len) {
+  if (len > MMWAVE_MAX_FRAME_SIZE)
+    return false;
+  if (size(lane) >= kLaneCapacity[lane])
+    dropOldest(lane);
+
+  Lane& l = _lanes[lane];
+#if MMWAVE_STATIC_MEMORY
+  for (int i = MMWAVE_LANE_COUNT - 1; _free_count == 0 && i >= 0; i--) {
+    if (_lanes[i].count)
+      dropOldest(i);
+  }
+  uint8_t slot = _free[--_free_count];
+  memcpy(_slots[slot], frame, len);
+  _slot_length[slot] = len;
+  l.ring[(l.first + l.count) % MMWAVE_STATIC_FRAME_SLOTS] = slot;
+  l.count++;
+#else
+  l.frames.emplace_back(frame, frame + len);
+#endif
+  return true;
+}
+
+/**
+ * @brief Overwrite a queued frame.
+ *
+ * @param seq The sequence number returned by lastSeq() after its push().
+ * @return false if that frame has already left the queue.
+ */
+bool mmWaveFrameQueue::replace(uint8_t lane, uint32_t seq, const uint8_t* frame,
+                               size_t len) {
+  Lane& l      = _lanes[lane];
+  size_t index = seq - l.head_seq;  // wraps above size() once popped
+  if (index >= size(lane) || len > MMWAVE_MAX_FRAME_SIZE)
+    return false;
+#if MMWAVE_STATIC_MEMORY
+  uint8_t slot = slotOf(l, index);
+  memcpy(_slots[slot], frame, len);
+  _slot_length[slot] = len;
+#else
+  l.frames[index].assign(frame, frame + len);
+#endif
+  return true;
+}
+
+const uint8_t* mmWaveFrameQueue::front(uint8_t lane, size_t& len) const {
+  if (size(lane) == 0)
+    return nullptr;
+  const Lane& l = _lanes[lane];
+#if MMWAVE_STATIC_MEMORY
+  uint8_t slot = slotOf(l, 0);
+  len          = _slot_length[slot];
+  return _slots[slot];
+#else
+  len = l.frames.front().size();
+  return l.frames.front().data();
+#endif
+}
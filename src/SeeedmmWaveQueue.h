@@ -0,0 +1,111 @@
+/**
+ * @file SeeedmmWaveQueue.h
+ * @date  18 October 2026
+ *
+ * @note Received-frame queue with one bounded FIFO per priority lane.
+ *
+ * @copyright © 2024, Seeed Studio
+ *
+ * @attention By default frames are held in heap-allocated vectors. With
+ * MMWAVE_STATIC_MEMORY set to 1 they are held in MMWAVE_STATIC_FRAME_SLOTS
+ * fixed slots of MMWAVE_MAX_FRAME_SIZE bytes; when every slot is in use the
+ * oldest frame of the lowest priority lane is dropped.
+ *
+ * Every pushed frame gets a per-lane sequence number, so a queued frame can
+ * be found again and replaced in place.
+ */
+
+#ifndef SEEEDMMWAVE_QUEUE_H
+#define SEEEDMMWAVE_QUEUE_H
+
+#include "SeeedmmWaveFrame.h"
+
+#if MMWAVE_STATIC_MEMORY == 0
+#  include <deque>
+#  include <vector>
+#endif
+
+#define MMWaveMaxQueueSize 2048
+
+#define MMWAVE_LANE_COUNT 4
+
+/* Frames held per lane, the oldest frame is dropped when full */
+#ifndef MMWAVE_LANE_ALARM_SIZE
+#  define MMWAVE_LANE_ALARM_SIZE 64
+#endif
+#ifndef MMWAVE_LANE_ACK_SIZE
+#  define MMWAVE_LANE_ACK_SIZE 16
+#endif
+#ifndef MMWAVE_LANE_STATE_SIZE
+#  define MMWAVE_LANE_STATE_SIZE 256
+#endif
+#ifndef MMWAVE_LANE_BULK_SIZE
+#  define MMWAVE_LANE_BULK_SIZE MMWaveMaxQueueSize
+#endif
+
+/* Frames held in total with MMWAVE_STATIC_MEMORY */
+#ifndef MMWAVE_STATIC_FRAME_SLOTS
+#  define MMWAVE_STATIC_FRAME_SLOTS 8
+#endif
+
+class mmWaveFrameQueue {
+ private:
+#if MMWAVE_STATIC_MEMORY
+  static_assert(MMWAVE_STATIC_FRAME_SLOTS > 0 &&
+                    MMWAVE_STATIC_FRAME_SLOTS <= 255,
+                "MMWAVE_STATIC_FRAME_SLOTS must be 1..255");
+
+  struct Lane {
+    uint8_t ring[MMWAVE_STATIC_FRAME_SLOTS];  // slot indices, oldest first
+    uint8_t first;
+    uint8_t count;
+    uint32_t head_seq;
+    uint32_t dropped;
+  };
+
+  uint8_t _slots[MMWAVE_STATIC_FRAME_SLOTS][MMWAVE_MAX_FRAME_SIZE];
+  uint16_t _slot_length[MMWAVE_STATIC_FRAME_SLOTS];
+  uint8_t _free[MMWAVE_STATIC_FRAME_SLOTS];
+  uint8_t _free_count;
+
+  uint8_t slotOf(const Lane& lane, size_t index) const {
+    return lane.ring[(lane.first + index) % MMWAVE_STATIC_FRAME_SLOTS];
+  }
+#else
+  struct Lane {
+    std::deque<std::vector<uint8_t>> frames;
+    uint32_t head_seq;
+    uint32_t dropped;
+  };
+#endif
+  Lane _lanes[MMWAVE_LANE_COUNT];
+
+  void dropOldest(uint8_t lane);
+
+ public:
+  mmWaveFrameQueue() {
+    clear();
+  }
+
+  void clear();
+
+  bool push(uint8_t lane, const uint8_t* frame, size_t len);
+  bool replace(uint8_t lane, uint32_t seq, const uint8_t* frame, size_t len);
+
+  /* Oldest frame of a lane, nullptr if the lane is empty */
+  const uint8_t* front(uint8_t lane, size_t& len) const;
+  void pop(uint8_t lane);
+
+  size_t size(uint8_t lane) const;
+  size_t size() const;
+  uint32_t dropped(uint8_t lane) const {
+    return _lanes[lane].dropped;
+  }
+
+  /* Sequence number of the newest frame of a lane */
+  uint32_t lastSeq(uint8_t lane) const {
+    return _lanes[lane].head_seq + size(lane) - 1;
+  }
+};
+
+#endif /*SEEEDMMWAVE_QUEUE_H*/
@@ -0,0 +1,133 @@
+/**
+ * @file SeeedmmWaveRoi.h
+ * @date  18 October 2026
+ *
+ * @note Region-of-interest filter applied while point clouds are decoded.
+ *
+ * @copyright © 2024, Seeed Studio
+ *
+ * @attention A point is kept when it lies in at least one of the boxes (or
+ * no box is set) and passes every gate that is set: the height band on
+ * z_point, the range gate on the distance from the sensor and the doppler
+ * gate on |dop_index|. Coordinates are in metres as reported. The MR60BHA2
+ * reports no height, its z_point is 0. An empty filter keeps every point.
+ * This header does not depend on Arduino.
+ *
+ * @code
+ * mmWaveRoiFilter roi;
+ * roi.addBox({-1.0f, 1.0f, 0.0f, 3.0f, -10.0f, 10.0f});
+ * roi.setDopplerGate(0.05f, 10.0f);  // moving points only
+ * mmWave.setRoi(roi);
+ * @endcode
+ */
+
+#ifndef SEEEDMMWAVE_ROI_H
+#define SEEEDMMWAVE_ROI_H
+
+#include "SEEED_Public.h"
+
+/* Boxes per filter */
+#ifndef MMWAVE_ROI_MAX_BOXES
+#  define MMWAVE_ROI_MAX_BOXES 4
+#endif
+
+typedef struct mmWaveRoiBox {
+  float x_min;
+  float x_max;
+  float y_min;
+  float y_max;
+  float z_min;
+  float z_max;
+} mmWaveRoiBox;
+
+class mmWaveRoiFilter {
+ private:
+  mmWaveRoiBox _boxes[MMWAVE_ROI_MAX_BOXES];
+  uint8_t _box_count = 0;
+
+  bool _height_gate  = false;
+  float _z_min       = 0;
+  float _z_max       = 0;
+  bool _range_gate   = false;
+  float _range2_min  = 0;  // squared, so no square root per point
+  float _range2_max  = 0;
+  bool _doppler_gate = false;
+  float _dop_min     = 0;
+  float _dop_max     = 0;
+
+  static bool inBox(const mmWaveRoiBox& box, const TargetN& point) {
+    return point.x_point >= box.x_min && point.x_point <= box.x_max &&
+           point.y_point >= box.y_min && point.y_point <= box.y_max &&
+           point.z_point >= box.z_min && point.z_point <= box.z_max;
+  }
+
+ public:
+  mmWaveRoiFilter() {}
+
+  /* Remove every box and gate */
+  void clear() {
+    *this = mmWaveRoiFilter();
+  }
+
+  /**
+   * @retval false The box is empty or MMWAVE_ROI_MAX_BOXES are set.
+   */
+  bool addBox(const mmWaveRoiBox& box) {
+    if (_box_count == MMWAVE_ROI_MAX_BOXES || box.x_min > box.x_max ||
+        box.y_min > box.y_max || box.z_min > box.z_max)
+      return false;
+    _boxes[_box_count++] = box;
+    return true;
+  }
+
+  void setHeightBand(float z_min, float z_max) {
+    _height_gate = true;
+    _z_min       = z_min;
+    _z_max       = z_max;
+  }
+
+  /* Distance from the sensor, from range_min to range_max */
+  void setRangeGate(float range_min, float range_max) {
+    _range_gate = true;
+    _range2_min = range_min * range_min;
+    _range2_max = range_max * range_max;
+  }
+
+  /* |dop_index| from dop_min to dop_max */
+  void setDopplerGate(float dop_min, float dop_max) {
+    _doppler_gate = true;
+    _dop_min      = dop_min;
+    _dop_max      = dop_max;
+  }
+
+  bool empty() const {
+    return _box_count == 0 && !_height_gate && !_range_gate &&
+           !_doppler_gate;
+  }
+
+  bool accept(const TargetN& point) const {
+    if (_height_gate && (point.z_point < _z_min || point.z_point > _z_max))
+      return false;
+    if (_doppler_gate) {
+      float dop = point.dop_index < 0 ? -point.dop_index : point.dop_index;
+      if (dop < _dop_min || dop > _dop_max)
+        return false;
+    }
+    if (_range_gate) {
+      float range2 = point.x_point * point.x_point +
+                     point.y_point * point.y_point +
+                     point.z_point * point.z_point;
+      if (range2 < _range2_min || range2 > _range2_max)
+        return false;
+    }
+    if (_box_count == 0)
+      return true;
+    for (uint8_t i = 0; i < _box_count; i++) {
+      if (inBox(_boxes[i], point))
+        return true;
+    }
+    return false;
+  }
+};
+
+#endif /*SEEEDMMWAVE_ROI_H*/
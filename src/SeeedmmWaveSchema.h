@@ -0,0 +1,450 @@
+/**
+ * @file SeeedmmWaveSchema.h
+ * @date  18 October 2026
+ *
+ * @note Declarative payload layouts of the MR60FDA2 and MR60BHA2 reports.
+ *
+ * @copyright © 2024, Seeed Studio
+ *
+ * @attention Each frame type is described once, as a list of fields (wire
+ * encoding, byte offset, destination member). The decoders are generated
+ * from that description at compile time: every field becomes a single load
+ * at a constant offset, the record loop has no per-field branches, and the
+ * payload length is checked against the record count before anything is
+ * read. Supporting a new frame type is one mmWaveSchema specialisation.
+ */
+
+#ifndef SEEEDMMWAVE_SCHEMA_H
+#define SEEEDMMWAVE_SCHEMA_H
+
+#include "SEEED_Public.h"
+#include "SeeedmmWaveBatch.h"
+#include "SeeedmmWaveFrame.h"
+
+/* Wire encodings */
+struct mmWaveWireU8 {
+  typedef uint8_t type;
+  static constexpr size_t kSize = 1;
+  static type load(const uint8_t* bytes) {
+    return bytes[0];
+  }
+};
+
+struct mmWaveWireU32 {
+  typedef uint32_t type;
+  static constexpr size_t kSize = 4;
+  static type load(const uint8_t* bytes) {
+    return mmWaveLoadU32(bytes);
+  }
+};
+
+struct mmWaveWireI32 {
+  typedef int32_t type;
+  static constexpr size_t kSize = 4;
+  static type load(const uint8_t* bytes) {
+    return mmWaveLoadI32(bytes);
+  }
+};
+
+struct mmWaveWireF32 {
+  typedef float type;
+  static constexpr size_t kSize = 4;
+  static type load(const uint8_t* bytes) {
+    return mmWaveLoadFloat(bytes);
+  }
+};
+
+/**
+ * @brief One field of a record: `Wire` at byte `Offset`, converted into
+ * `Struct::*Ptr`. Use MMWAVE_FIELD() to spell it.
+ */
+template <class Wire, size_t Offset, class Struct, class Member,
+          Member Struct::*Ptr>
+struct mmWaveField {
+  static constexpr size_t kOffset = Offset;
+  static constexpr size_t kEnd    = Offset + Wire::kSize;
+  static constexpr bool kIs32     = Wire::kSize == 4;
+
+  static void decode(const uint8_t* record, Struct& out) {
+    out.*Ptr = static_cast<Member>(Wire::load(record + Offset));
+  }
+};
+
+#define MMWAVE_FIELD(wire, offset, Struct, member)                            \
+  mmWaveField<mmWaveWire##wire, offset, Struct, decltype(Struct::member),     \
+              &Struct::member>
+
+template <class... Fields>
+struct mmWaveFieldsEnd {
+  static constexpr size_t value = 0;
+};
+
+template <class... Fields>
+struct mmWaveFieldsAre32 {
+  static constexpr bool value = true;
+};
+
+template <class First, class... Rest>
+struct mmWaveFieldsAre32<First, Rest...> {
+  static constexpr bool value =
+      First::kIs32 && mmWaveFieldsAre32<Rest...>::value;
+};
+
+template <class First, class... Rest>
+struct mmWaveFieldsEnd<First, Rest...> {
+  static constexpr size_t value =
+      First::kEnd > mmWaveFieldsEnd<Rest...>::value
+          ? First::kEnd
+          : mmWaveFieldsEnd<Rest...>::value;
+};
+
+/**
+ * @brief A fixed-size record of `Stride` bytes decoded into `Struct`.
+ * Members without a field are value-initialised.
+ */
+template <size_t Stride, class Struct, class... Fields>
+struct mmWaveRecord {
+  static_assert(mmWaveFieldsEnd<Fields...>::value <= Stride,
+                "field outside of the record");
+
+  typedef Struct type;
+  static constexpr size_t kStride    = Stride;
+  static constexpr size_t kNumFields = sizeof...(Fields);
+  static constexpr bool kAll32       = mmWaveFieldsAre32<Fields...>::value;
+
+  /* Decoded into a local first: `out` may alias the bytes as far as the
+   * compiler knows, which would order every load after the last store */
+  static void decode(const uint8_t* record, Struct& out) {
+    Struct value = Struct();
+    int unroll[] = {(Fields::decode(record, value), 0)...};
+    (void)unroll;
+    out = value;
+  }
+
+  /* Field offsets in declaration order */
+  static const uint8_t* offsets() {
+    static const uint8_t kOffsets[] = {
+        static_cast<uint8_t>(Fields::kOffset)...};
+    return kOffsets;
+  }
+};
+
+/**
+ * @brief A payload holding one record.
+ */
+template <class Record>
+struct mmWaveFixed {
+  typedef typename Record::type type;
+  static constexpr size_t kMinLength = Record::kStride;
+
+  static bool decode(const uint8_t* data, size_t data_len, type& out) {
+    if (data_len < Record::kStride)
+      return false;
+    Record::decode(data, out);
+    return true;
+  }
+};
+
+/**
+ * @brief A payload holding one scalar.
+ */
+template <class Wire, class T = typename Wire::type>
+struct mmWaveScalar {
+  typedef T type;
+  static constexpr size_t kMinLength = Wire::kSize;
+
+  static bool decode(const uint8_t* data, size_t data_len, T& out) {
+    if (data_len < Wire::kSize)
+      return false;
+    out = static_cast<T>(Wire::load(data));
+    return true;
+  }
+};
+
+/**
+ * @brief A payload holding a record count followed by that many records.
+ */
+template <class Count, class Record>
+struct mmWaveRepeated {
+  typedef typename Record::type type;
+  typedef Record record_type;
+  static constexpr size_t kMinLength = Count::kSize;
+
+  /**
+   * @brief Number of records, or -1 if the payload is too short for it.
+   */
+  static int32_t count(const uint8_t* data, size_t data_len) {
+    if (data_len < Count::kSize)
+      return -1;
+    uint32_t count = static_cast<uint32_t>(Count::load(data));
+    if (count > (data_len - Count::kSize) / Record::kStride)
+      return -1;
+    return static_cast<int32_t>(count);
+  }
+
+  static const uint8_t* record(const uint8_t* data, size_t index) {
+    return data + Count::kSize + index * Record::kStride;
+  }
+
+  static bool decode(const uint8_t* data, size_t data_len,
+                     std::vector<type>& out) {
+    int32_t num = count(data, data_len);
+    if (num < 0)
+      return false;
+
+    out.resize(num);
+    const uint8_t* p = data + Count::kSize;
+    for (int32_t i = 0; i < num; i++, p += Record::kStride) {
+      Record::decode(p, out[i]);
+    }
+    return true;
+  }
+
+  /**
+   * @brief Decode only the records `keep.accept()` takes. A rejected record
+   * is decoded into a temporary and never stored in `out`.
+   *
+   * @param rejected Set to the number of records not taken.
+   */
+  template <class Filter>
+  static bool decode(const uint8_t* data, size_t data_len,
+                     std::vector<type>& out, const Filter& keep,
+                     uint32_t& rejected) {
+    int32_t num = count(data, data_len);
+    if (num < 0)
+      return false;
+
+    out.clear();
+    out.reserve(num);
+    rejected         = 0;
+    const uint8_t* p = data + Count::kSize;
+    for (int32_t i = 0; i < num; i++, p += Record::kStride) {
+      type record;
+      Record::decode(p, record);
+      if (keep.accept(record))
+        out.push_back(record);
+      else
+        rejected++;
+    }
+    return true;
+  }
+
+  /**
+   * @brief Decode the records into one array per field, in the order the
+   * fields are declared. Values are copied as they are on the wire, without
+   * the conversion decode() applies to the member type.
+   *
+   * @param columns Record::kNumFields arrays of `capacity` 32-bit elements.
+   * @return The number of records, -1 if the payload is malformed or holds
+   * more than `capacity` records.
+   */
+  static int32_t decodeColumns(const uint8_t* data, size_t data_len,
+                               void* const* columns, size_t capacity) {
+    static_assert(Record::kAll32, "column decode needs 32-bit fields");
+    int32_t num = count(data, data_len);
+    if (num < 0 || static_cast<size_t>(num) > capacity)
+      return -1;
+    if (!mmWaveBatchLoad32(data + Count::kSize, data_len - Count::kSize,
+                           Record::kStride, num, Record::offsets(),
+                           Record::kNumFields, columns))
+      return -1;
+    return num;
+  }
+};
+
+/* Structured payloads without a dedicated type elsewhere */
+typedef struct FallRadarParameters {
+  float height;
+  float threshold;
+  uint32_t sensitivity;
+  float rect_XL;
+  float rect_XR;
+  float rect_ZF;
+  float rect_ZB;
+} FallRadarParameters;
+
+typedef struct HeartBreathDistance {
+  uint32_t flag;
+  float range;
+} HeartBreathDistance;
+
+/**
+ * @brief Payload layout of a frame type. Only the specialisations below
+ * exist, so using an undescribed type fails to compile.
+ */
+template <class Enum, Enum Type>
+struct mmWaveSchema;
+
+#define MMWAVE_SCHEMA(Enum, Type, ...)                                         \
+  template <>                                                                  \
+  struct mmWaveSchema<Enum, Enum::Type> : __VA_ARGS__ {}
+
+/* clang-format off */
+
+/* One byte status or acknowledgement */
+typedef mmWaveScalar<mmWaveWireU8, bool> mmWaveFlag;
+
+/* MR60FDA2 point record: cluster, x, y, z, doppler */
+typedef mmWaveRecord<20, TargetN,
+                     MMWAVE_FIELD(I32, 0, TargetN, cluster_index),
+                     MMWAVE_FIELD(F32, 4, TargetN, x_point),
+                     MMWAVE_FIELD(F32, 8, TargetN, y_point),
+                     MMWAVE_FIELD(F32, 12, TargetN, z_point),
+                     MMWAVE_FIELD(F32, 16, TargetN, dop_index)>
+    mmWaveFallTargetRecord;
+
+/* MR60BHA2 point record: x, y, doppler, cluster (integers on the wire) */
+typedef mmWaveRecord<16, TargetN,
+                     MMWAVE_FIELD(F32, 0, TargetN, x_point),
+                     MMWAVE_FIELD(F32, 4, TargetN, y_point),
+                     MMWAVE_FIELD(U32, 8, TargetN, dop_index),
+                     MMWAVE_FIELD(U32, 12, TargetN, cluster_index)>
+    mmWaveBreathTargetRecord;
+
+MMWAVE_SCHEMA(TypeFallDetection, ReportFallDetection, mmWaveFlag);
+MMWAVE_SCHEMA(TypeFallDetection, ReportUnmannedDetection, mmWaveFlag);
+MMWAVE_SCHEMA(TypeFallDetection, InstallationHeight, mmWaveFlag);
+MMWAVE_SCHEMA(TypeFallDetection, FallThreshold, mmWaveFlag);
+MMWAVE_SCHEMA(TypeFallDetection, FallSensitivity, mmWaveFlag);
+MMWAVE_SCHEMA(TypeFallDetection, AlarmParameters, mmWaveFlag);
+MMWAVE_SCHEMA(TypeFallDetection, RadarParameters,
+              mmWaveFixed<mmWaveRecord<28, FallRadarParameters,
+                  MMWAVE_FIELD(F32, 0, FallRadarParameters, height),
+                  MMWAVE_FIELD(F32, 4, FallRadarParameters, threshold),
+                  MMWAVE_FIELD(U32, 8, FallRadarParameters, sensitivity),
+                  MMWAVE_FIELD(F32, 12, FallRadarParameters, rect_XL),
+                  MMWAVE_FIELD(F32, 16, FallRadarParameters, rect_XR),
+                  MMWAVE_FIELD(F32, 20, FallRadarParameters, rect_ZF),
+                  MMWAVE_FIELD(F32, 24, FallRadarParameters, rect_ZB)>>);
+MMWAVE_SCHEMA(TypeFallDetection, Report3DPointCloudDetection,
+              mmWaveRepeated<mmWaveWireI32, mmWaveFallTargetRecord>);
+MMWAVE_SCHEMA(TypeFallDetection, Report3DPointCloudTartgetInfo,
+              mmWaveRepeated<mmWaveWireI32, mmWaveFallTargetRecord>);
+
+MMWAVE_SCHEMA(TypeHeartBreath, TypeHeartBreathPhase,
+              mmWaveFixed<mmWaveRecord<12, HeartBreath,
+                  MMWAVE_FIELD(F32, 0, HeartBreath, total_phase),
+                  MMWAVE_FIELD(F32, 4, HeartBreath, breath_phase),
+                  MMWAVE_FIELD(F32, 8, HeartBreath, heart_phase)>>);
+MMWAVE_SCHEMA(TypeHeartBreath, TypeBreathRate, mmWaveScalar<mmWaveWireF32>);
+MMWAVE_SCHEMA(TypeHeartBreath, TypeHeartRate, mmWaveScalar<mmWaveWireF32>);
+MMWAVE_SCHEMA(TypeHeartBreath, TypeHeartBreathDistance,
+              mmWaveFixed<mmWaveRecord<8, HeartBreathDistance,
+                  MMWAVE_FIELD(U32, 0, HeartBreathDistance, flag),
+                  MMWAVE_FIELD(F32, 4, HeartBreathDistance, range)>>);
+MMWAVE_SCHEMA(TypeHeartBreath, ReportHumanDetection, mmWaveFlag);
+MMWAVE_SCHEMA(TypeHeartBreath, Report3DPointCloudDetection,
+              mmWaveRepeated<mmWaveWireU32, mmWaveBreathTargetRecord>);
+MMWAVE_SCHEMA(TypeHeartBreath, Report3DPointCloudTartgetInfo,
+              mmWaveRepeated<mmWaveWireU32, mmWaveBreathTargetRecord>);
+
+/* clang-format on */
+
+/* Most points a frame of MMWAVE_MAX_FRAME_DATA bytes can carry */
+#ifndef MMWAVE_MAX_POINTS
+#  define MMWAVE_MAX_POINTS                                                    \
+    ((MMWAVE_MAX_FRAME_DATA - 4) / mmWaveBreathTargetRecord::kStride)
+#endif
+
+/**
+ * @brief Give a decoded cloud its final capacity up front. With
+ * MMWAVE_STATIC_MEMORY decoding never grows it afterwards.
+ */
+inline void mmWaveReserveCloud(PeopleCounting& cloud) {
+#if MMWAVE_STATIC_MEMORY
+  cloud.targets.reserve(MMWAVE_MAX_POINTS);
+#else
+  (void)cloud;
+#endif
+}
+
+/**
+ * @brief Hand a decoded cloud to the caller. With MMWAVE_STATIC_MEMORY it
+ * is copied, so the reserved buffer stays with the decoder; otherwise it is
+ * moved. The copy only stays off the heap if `to` was given its capacity
+ * with mmWaveReserveCloud(). Swapping the buffers would not help: the
+ * decoder would then hold the caller's buffer, unreserved.
+ */
+inline void mmWaveTakeCloud(PeopleCounting& from, PeopleCounting& to) {
+#if MMWAVE_STATIC_MEMORY
+  to.targets.assign(from.targets.begin(), from.targets.end());
+#else
+  to = std::move(from);
+#endif
+}
+
+template <TypeFallDetection Type>
+using mmWaveFallSchema = mmWaveSchema<TypeFallDetection, Type>;
+
+template <TypeHeartBreath Type>
+using mmWaveBreathSchema = mmWaveSchema<TypeHeartBreath, Type>;
+
+/**
+ * @brief The validated payload of a repeated report, decoded on access.
+ *
+ * Storing a payload only checks its record count and copies the bytes;
+ * records are decoded when at() or decode() is called, so reports that are
+ * never read are never decoded.
+ */
+template <class Repeated>
+class mmWaveCloudView {
+ private:
+  std::vector<uint8_t> _payload;
+  size_t _count = 0;
+
+ public:
+  typedef typename Repeated::type type;
+
+#if MMWAVE_STATIC_MEMORY
+  static constexpr size_t kReservedBytes = MMWAVE_MAX_FRAME_DATA;
+
+  mmWaveCloudView() {
+    _payload.reserve(MMWAVE_MAX_FRAME_DATA);
+  }
+#else
+  mmWaveCloudView() {}
+#endif
+
+  bool store(const uint8_t* data, size_t data_len) {
+    int32_t num = Repeated::count(data, data_len);
+    if (num < 0)
+      return false;
+    _payload.assign(data, data + data_len);
+    _count = num;
+    return true;
+  }
+
+  size_t size() const {
+    return _count;
+  }
+
+  /* Decode one record, `index` must be below size() */
+  type at(size_t index) const {
+    type out;
+    Repeated::record_type::decode(Repeated::record(_payload.data(), index),
+                                  out);
+    return out;
+  }
+
+  /* Decode every record */
+  bool decode(std::vector<type>& out) const {
+    return Repeated::decode(_payload.data(), _payload.size(), out);
+  }
+
+  /* Decode the records `keep` accepts, see mmWaveRepeated */
+  template <class Filter>
+  bool decode(std::vector<type>& out, const Filter& keep,
+              uint32_t& rejected) const {
+    return Repeated::decode(_payload.data(), _payload.size(), out, keep,
+                            rejected);
+  }
+};
+
+typedef mmWaveCloudView<
+    mmWaveFallSchema<TypeFallDetection::Report3DPointCloudDetection>>
+    mmWaveFallCloudView;
+typedef mmWaveCloudView<
+    mmWaveBreathSchema<TypeHeartBreath::Report3DPointCloudDetection>>
+    mmWaveBreathCloudView;
+
+#endif /*SEEEDMMWAVE_SCHEMA_H*/
@@ -0,0 +1,128 @@
+/**
+ * @file SeeedmmWaveSequence.cpp
+ * @date  18 October 2026
+ *
+ * @note Loss accounting on the 16-bit id of received frames.
+ *
+ * @copyright © 2024, Seeed Studio
+ */
+
+#include "SeeedmmWaveSequence.h"
+
+#define MMWAVE_SEQUENCE_ANY_TYPE 0xFFFF
+
+void mmWaveSequenceTracker::setScope(mmWaveSequenceScope scope) {
+  _scope        = scope;
+  _stream_count = 0;
+}
+
+/* The stream of a type, started on its first frame */
+mmWaveSequenceTracker::Stream* mmWaveSequenceTracker::stream(uint16_t type) {
+  if (_scope == mmWaveSequenceScope::Global)
+    type = MMWAVE_SEQUENCE_ANY_TYPE;
+  for (uint8_t i = 0; i < _stream_count; i++) {
+    if (_streams[i].type == type)
+      return &_streams[i];
+  }
+  if (_stream_count == MMWAVE_SEQUENCE_STREAMS)
+    return nullptr;
+  Stream& added = _streams[_stream_count++];
+  added.type    = type;
+  added.window  = 0;  // marks a stream without an id yet
+  return &added;
+}
+
+/**
+ * @brief Account for a received frame.
+ *
+ * @param type The frame type.
+ * @param id The frame id.
+ */
+void mmWaveSequenceTracker::observe(uint16_t type, uint16_t id) {
+  if (_scope == mmWaveSequenceScope::Off)
+    return;
+  Stream* found = stream(type);
+  if (!found) {
+    _stats.untracked++;
+    return;
+  }
+  _stats.received++;
+  track(*found, id);
+}
+
+void mmWaveSequenceTracker::startAt(Stream& stream, uint16_t id) {
+  stream.last      = id;
+  stream.history   = 0;
+  stream.stale_run = 0;
+  stream.window    = 1;
+}
+
+/* Whether a stale id completes a run taken as a restart of the counter */
+bool mmWaveSequenceTracker::staleRun(Stream& stream, uint16_t id) {
+  int16_t ahead =
+      static_cast<int16_t>(static_cast<uint16_t>(id - stream.stale_last));
+  if (stream.stale_run > 0 && ahead > 0 && ahead <= MMWAVE_SEQUENCE_RESYNC)
+    stream.stale_run++;
+  else
+    stream.stale_run = 1;
+  stream.stale_last = id;
+  return stream.stale_run >= MMWAVE_SEQUENCE_STALE_RUN;
+}
+
+void mmWaveSequenceTracker::track(Stream& stream, uint16_t id) {
+  if (stream.window == 0) {
+    startAt(stream, id);
+    return;
+  }
+
+  // Signed distance modulo 2^16, positive when id is newer
+  int16_t ahead = static_cast<int16_t>(static_cast<uint16_t>(id - stream.last));
+  int32_t jump  = ahead < 0 ? -ahead : ahead;
+  if (jump > MMWAVE_SEQUENCE_RESYNC) {
+    _stats.resyncs++;
+    startAt(stream, id);
+    return;
+  }
+
+  if (ahead > 0) {
+    stream.stale_run = 0;
+    if (ahead > 1) {
+      uint16_t skipped = ahead - 1;
+      _stats.gaps++;
+      _stats.lost += skipped;
+      if (_on_loss)
+        _on_loss(stream.type, stream.last + 1, skipped, _loss_context);
+    }
+    stream.window  = ahead < 32 ? (stream.window << ahead) | 1 : 1;
+    stream.history = ahead < MMWAVE_SEQUENCE_WINDOW - stream.history
+                         ? stream.history + ahead
+                         : MMWAVE_SEQUENCE_WINDOW;
+    stream.last    = id;
+    return;
+  }
+
+  uint16_t behind = -ahead;
+  if (behind >= MMWAVE_SEQUENCE_WINDOW) {
+    if (staleRun(stream, id)) {
+      // The earlier ids of the run were counted stale, they were not
+      uint32_t recounted = MMWAVE_SEQUENCE_STALE_RUN - 1;
+      _stats.stale -= _stats.stale < recounted ? _stats.stale : recounted;
+      _stats.resyncs++;
+      startAt(stream, id);
+      return;
+    }
+    _stats.stale++;  // cannot be told from a duplicate
+    return;
+  }
+  stream.stale_run = 0;
+  uint32_t bit = 1UL << behind;
+  if (stream.window & bit) {
+    _stats.duplicates++;
+    return;
+  }
+  stream.window |= bit;
+  _stats.reordered++;
+  // Only ids after the first of the stream were counted lost by a gap
+  if (behind <= stream.history && _stats.lost > 0)
+    _stats.lost--;
+}
@@ -0,0 +1,132 @@
+/**
+ * @file SeeedmmWaveSequence.h
+ * @date  18 October 2026
+ *
+ * @note Loss accounting on the 16-bit id of received frames.
+ *
+ * @copyright © 2024, Seeed Studio
+ *
+ * @attention Ids are compared modulo 2^16, so the tracker follows the id
+ * through its wraparound. Each stream remembers its newest id and a bitmap
+ * of the MMWAVE_SEQUENCE_WINDOW ids before it, which tells a duplicate from
+ * a frame that arrives late. A frame reported lost is taken off the loss
+ * count of its stream again if it turns up later within the window. A frame
+ * older than the window may be late or a duplicate, it is counted as stale
+ * and leaves the loss count alone. A jump of more than
+ * MMWAVE_SEQUENCE_RESYNC ids in either direction is taken as a restart of
+ * the module and counted as a resync, not as loss. So is a run of
+ * MMWAVE_SEQUENCE_STALE_RUN stale ids, each newer than the one before: a
+ * module reset starts its ids again below the last one seen, often by less
+ * than MMWAVE_SEQUENCE_RESYNC. The stream then restarts from the newest of
+ * the run, which is no longer counted stale. This header does not
+ * depend on Arduino.
+ */
+
+#ifndef SEEEDMMWAVE_SEQUENCE_H
+#define SEEEDMMWAVE_SEQUENCE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Ids remembered behind the newest one, at most 32 */
+#ifndef MMWAVE_SEQUENCE_WINDOW
+#  define MMWAVE_SEQUENCE_WINDOW 32
+#endif
+
+/* Largest id jump still counted as loss */
+#ifndef MMWAVE_SEQUENCE_RESYNC
+#  define MMWAVE_SEQUENCE_RESYNC 1024
+#endif
+
+/* Increasing stale ids in a row taken as a restart of the id counter */
+#ifndef MMWAVE_SEQUENCE_STALE_RUN
+#  define MMWAVE_SEQUENCE_STALE_RUN 8
+#endif
+
+/* Frame types tracked with mmWaveSequenceScope::PerType */
+#ifndef MMWAVE_SEQUENCE_STREAMS
+#  define MMWAVE_SEQUENCE_STREAMS 8
+#endif
+
+static_assert(MMWAVE_SEQUENCE_WINDOW > 0 && MMWAVE_SEQUENCE_WINDOW <= 32,
+              "MMWAVE_SEQUENCE_WINDOW must be 1..32");
+static_assert(MMWAVE_SEQUENCE_STALE_RUN >= 2 &&
+                  MMWAVE_SEQUENCE_STALE_RUN <= 255,
+              "MMWAVE_SEQUENCE_STALE_RUN must be 2..255");
+
+enum class mmWaveSequenceScope : uint8_t {
+  Off,
+  Global,   // one id counter for every frame the module sends
+  PerType,  // one id counter per frame type
+};
+
+typedef struct mmWaveSequenceStats {
+  uint32_t received;    // frames tracked
+  uint32_t lost;        // ids skipped and not seen since
+  uint32_t gaps;        // times one or more ids were skipped
+  uint32_t duplicates;  // ids seen twice
+  uint32_t reordered;   // ids seen after a newer one, within the window
+  uint32_t stale;       // ids older than the window, late or duplicate
+  uint32_t resyncs;     // jumps taken as a restart of the id counter
+  uint32_t untracked;   // frames of types beyond MMWAVE_SEQUENCE_STREAMS
+} mmWaveSequenceStats;
+
+/**
+ * @brief Called for each gap: `count` ids from `first_id` on were skipped
+ * in the stream of `type`, which is 0xFFFF for mmWaveSequenceScope::Global.
+ */
+typedef void (*mmWaveLossCallback)(uint16_t type, uint16_t first_id,
+                                   uint16_t count, void* context);
+
+class mmWaveSequenceTracker {
+ private:
+  struct Stream {
+    uint16_t type;
+    uint16_t last;        // newest id
+    uint8_t history;      // ids of the stream behind last, at most the window
+    uint8_t stale_run;    // stale ids in a row, each newer than the one before
+    uint16_t stale_last;  // newest of them
+    uint32_t window;      // bit n: id last - n was seen
+  };
+
+  Stream _streams[MMWAVE_SEQUENCE_STREAMS];
+  uint8_t _stream_count      = 0;
+  mmWaveSequenceScope _scope = mmWaveSequenceScope::Global;
+  mmWaveSequenceStats _stats = {};
+
+  mmWaveLossCallback _on_loss = nullptr;
+  void* _loss_context         = nullptr;
+
+  Stream* stream(uint16_t type);
+  void track(Stream& stream, uint16_t id);
+  void startAt(Stream& stream, uint16_t id);
+  bool staleRun(Stream& stream, uint16_t id);
+
+ public:
+  mmWaveSequenceTracker() {}
+
+  /* Also forgets the ids seen so far */
+  void setScope(mmWaveSequenceScope scope);
+  mmWaveSequenceScope scope() const {
+    return _scope;
+  }
+  void setLossCallback(mmWaveLossCallback callback, void* context = nullptr) {
+    _on_loss      = callback;
+    _loss_context = context;
+  }
+
+  void observe(uint16_t type, uint16_t id);
+
+  /* Keeps the counters, the next id of every stream starts afresh */
+  void restart() {
+    _stream_count = 0;
+  }
+  void clearStats() {
+    _stats = mmWaveSequenceStats();
+  }
+  const mmWaveSequenceStats& stats() const {
+    return _stats;
+  }
+};
+
+#endif /*SEEEDMMWAVE_SEQUENCE_H*/
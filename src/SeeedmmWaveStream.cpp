@@ -0,0 +1,197 @@
+/**
+ * @file SeeedmmWaveStream.cpp
+ * @date  18 October 2026
+ *
+ * @note Compact binary point-cloud stream for forwarding clouds to a host.
+ *
+ * @copyright © 2024, Seeed Studio
+ */
+
+#include "SeeedmmWaveStream.h"
+
+#include <math.h>
+
+/* Round to the nearest step and saturate to int16 */
+static int16_t toFixed16(float value, float scale) {
+  float scaled = roundf(value * scale);
+  if (!(scaled > -32768.0f))  // also catches NaN
+    return -32768;
+  if (scaled > 32767.0f)
+    return 32767;
+  return static_cast<int16_t>(scaled);
+}
+
+/* CRC-16/CCITT-FALSE, the XOR checksum of the radar frames misses a
+ * corrupted COBS code byte too often */
+static uint16_t crc16Update(uint16_t crc, uint8_t byte) {
+  crc ^= byte << 8;
+  for (int bit = 0; bit < 8; bit++) {
+    crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+  }
+  return crc;
+}
+
+static inline uint16_t loadU16(const uint8_t* bytes) {
+  return bytes[0] | (bytes[1] << 8);
+}
+
+/**
+ * @brief Writes COBS encoded bytes. Each block starts with a code byte
+ * that is filled in once the block ends, at a zero byte or after 254 data
+ * bytes.
+ */
+class CobsWriter {
+ private:
+  uint8_t* _out;
+  size_t _length;
+  size_t _code_pos;
+  uint16_t _crc;
+
+  void endBlock(uint8_t code) {
+    _out[_code_pos] = code;
+    _code_pos       = _length++;
+  }
+
+ public:
+  explicit CobsWriter(uint8_t* out)
+      : _out(out), _length(1), _code_pos(0), _crc(0xFFFF) {}
+
+  void put(uint8_t byte) {
+    _crc = crc16Update(_crc, byte);
+    if (byte == 0) {
+      endBlock(_length - _code_pos);
+      return;
+    }
+    _out[_length++] = byte;
+    if (_length - _code_pos == 0xFF)
+      endBlock(0xFF);
+  }
+  void put16(uint16_t value) {
+    put(value & 0xFF);
+    put(value >> 8);
+  }
+  void put32(uint32_t value) {
+    put16(value & 0xFFFF);
+    put16(value >> 16);
+  }
+
+  /* Append the CRC and the delimiter, return the frame size */
+  size_t finish() {
+    put16(_crc);
+    _out[_code_pos] = _length - _code_pos;
+    _out[_length++] = 0x00;
+    return _length;
+  }
+};
+
+/**
+ * @brief Encode a cloud into data().
+ *
+ * @param cloud The points, only the first MMWAVE_STREAM_MAX_POINTS are sent.
+ * @param timestamp Receive time of the cloud, in ms.
+ * @return The frame size, including the delimiter.
+ */
+size_t mmWaveStreamEncoder::encode(const PeopleCounting& cloud,
+                                   uint32_t timestamp) {
+  size_t count = cloud.targets.size();
+  if (count > MMWAVE_STREAM_MAX_POINTS)
+    count = MMWAVE_STREAM_MAX_POINTS;
+
+  CobsWriter writer(_buffer);
+  writer.put(MMWAVE_STREAM_VERSION);
+  writer.put16(_sequence++);
+  writer.put32(timestamp);
+  writer.put16(count);
+  for (size_t i = 0; i < count; i++) {
+    const TargetN& target = cloud.targets[i];
+    writer.put16(toFixed16(target.x_point, 1000.0f));
+    writer.put16(toFixed16(target.y_point, 1000.0f));
+    writer.put16(toFixed16(target.z_point, 1000.0f));
+    writer.put16(toFixed16(target.dop_index, 1000.0f));
+    int32_t cluster = target.cluster_index;
+    if (cluster < 0)
+      cluster = MMWAVE_STREAM_NO_CLUSTER;
+    else if (cluster >= MMWAVE_STREAM_NO_CLUSTER)
+      cluster = MMWAVE_STREAM_NO_CLUSTER - 1;
+    writer.put(cluster);
+  }
+  return writer.finish();
+}
+
+void mmWaveStreamDecoder::reset() {
+  _length    = 0;
+  _code      = 0;
+  _remaining = 0;
+  _overflow  = false;
+}
+
+/**
+ * @brief Push one received byte.
+ *
+ * @retval true A valid record was completed, see record().
+ * @retval false More bytes are needed, or the record was rejected.
+ */
+bool mmWaveStreamDecoder::push(uint8_t byte) {
+  if (byte == 0x00) {
+    bool complete = _length > 0 && _remaining == 0 && !_overflow;
+    bool valid    = complete && decode();
+    if (!valid && (_length > 0 || _overflow))
+      _errors++;
+    reset();
+    return valid;
+  }
+  if (_overflow)
+    return false;
+
+  if (_remaining == 0) {
+    // A block shorter than 254 bytes stands for its data and a zero byte,
+    // the zero after the last block is implied and never stored.
+    bool zero  = _code != 0 && _code != 0xFF;
+    _code      = byte;
+    _remaining = byte - 1;
+    if (zero)
+      append(0x00);
+    return false;
+  }
+  _remaining--;
+  append(byte);
+  return false;
+}
+
+void mmWaveStreamDecoder::append(uint8_t byte) {
+  if (_length == sizeof(_buffer))
+    _overflow = true;
+  else
+    _buffer[_length++] = byte;
+}
+
+bool mmWaveStreamDecoder::decode() {
+  if (_length < MMWAVE_STREAM_HEADER_SIZE + 2 ||
+      _buffer[0] != MMWAVE_STREAM_VERSION)
+    return false;
+  size_t count = loadU16(_buffer + 7);
+  if (_length != MMWAVE_STREAM_HEADER_SIZE +
+                     count * MMWAVE_STREAM_POINT_SIZE + 2)
+    return false;
+  uint16_t crc = 0xFFFF;
+  for (size_t i = 0; i < _length - 2; i++) {
+    crc = crc16Update(crc, _buffer[i]);
+  }
+  if (crc != loadU16(_buffer + _length - 2))
+    return false;
+
+  _record.sequence  = loadU16(_buffer + 1);
+  _record.timestamp = mmWaveLoadU32(_buffer + 3);
+  _record.cloud.targets.resize(count);
+  const uint8_t* point = _buffer + MMWAVE_STREAM_HEADER_SIZE;
+  for (size_t i = 0; i < count; i++, point += MMWAVE_STREAM_POINT_SIZE) {
+    TargetN& target      = _record.cloud.targets[i];
+    target.x_point       = static_cast<int16_t>(loadU16(point + 0)) * 0.001f;
+    target.y_point       = static_cast<int16_t>(loadU16(point + 2)) * 0.001f;
+    target.z_point       = static_cast<int16_t>(loadU16(point + 4)) * 0.001f;
+    target.dop_index     = static_cast<int16_t>(loadU16(point + 6)) * 0.001f;
+    target.cluster_index =
+        point[8] == MMWAVE_STREAM_NO_CLUSTER ? -1 : point[8];
+  }
+  return true;
+}
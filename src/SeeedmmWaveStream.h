@@ -0,0 +1,122 @@
+/**
+ * @file SeeedmmWaveStream.h
+ * @date  18 October 2026
+ *
+ * @note Compact binary point-cloud stream for forwarding clouds to a host.
+ *
+ * @copyright © 2024, Seeed Studio
+ *
+ * @attention A record is COBS encoded and terminated by a 0x00 byte, so a
+ * receiver resynchronises on the next delimiter after a lost byte. Before
+ * encoding a record is laid out as, little-endian:
+ *
+ *   u8  version       MMWAVE_STREAM_VERSION
+ *   u16 sequence      incremented by every encode()
+ *   u32 timestamp     ms, as given to encode()
+ *   u16 count         number of points, gives the record length
+ *   count x 9 bytes   i16 x, y, z in mm, i16 doppler in mm/s, u8 cluster
+ *   u16 crc           CRC-16/CCITT-FALSE of the bytes above
+ *
+ * Nine bytes per point against about 150 for the JSON of the demos.
+ * Coordinates saturate at +-32.767 m and clusters at 254. Cluster 255 is
+ * reserved for points in no cluster, a negative cluster_index, which the
+ * decoder returns as -1. This header does not depend on Arduino, the
+ * decoder is meant for host side tools.
+ */
+
+#ifndef SEEEDMMWAVE_STREAM_H
+#define SEEEDMMWAVE_STREAM_H
+
+#include "SEEED_Public.h"
+#include "SeeedmmWaveFrame.h"
+#include "SeeedmmWaveSchema.h"
+
+#define MMWAVE_STREAM_VERSION 1
+
+/* Points per record, encode() drops the points above it */
+#ifndef MMWAVE_STREAM_MAX_POINTS
+#  define MMWAVE_STREAM_MAX_POINTS MMWAVE_MAX_POINTS
+#endif
+
+/* Cluster byte of a point in no cluster */
+#define MMWAVE_STREAM_NO_CLUSTER 0xFF
+
+#define MMWAVE_STREAM_HEADER_SIZE 9
+#define MMWAVE_STREAM_POINT_SIZE  9
+#define MMWAVE_STREAM_MAX_RECORD                                               \
+  (MMWAVE_STREAM_HEADER_SIZE +                                                 \
+   MMWAVE_STREAM_MAX_POINTS * MMWAVE_STREAM_POINT_SIZE + 2)
+/* COBS adds one byte per 254 and the code byte, plus the delimiter */
+#define MMWAVE_STREAM_MAX_FRAME                                                \
+  (MMWAVE_STREAM_MAX_RECORD + MMWAVE_STREAM_MAX_RECORD / 254 + 2)
+
+/**
+ * @brief Packs clouds into stream frames, in a buffer reused for every
+ * frame so the frame goes out with a single write().
+ *
+ * @code
+ * size_t len = encoder.encode(cloud, millis());
+ * Serial.write(encoder.data(), len);
+ * @endcode
+ */
+class mmWaveStreamEncoder {
+ private:
+  uint8_t _buffer[MMWAVE_STREAM_MAX_FRAME];
+  uint16_t _sequence = 0;
+
+ public:
+  mmWaveStreamEncoder() {}
+
+  size_t encode(const PeopleCounting& cloud, uint32_t timestamp);
+
+  /* Valid after encode(), until the next encode() */
+  const uint8_t* data() const {
+    return _buffer;
+  }
+  /* Sequence number of the next record */
+  uint16_t sequence() const {
+    return _sequence;
+  }
+};
+
+typedef struct mmWaveStreamRecord {
+  uint16_t sequence;
+  uint32_t timestamp;
+  PeopleCounting cloud;
+} mmWaveStreamRecord;
+
+/**
+ * @brief Incremental stream decoder.
+ *
+ * Bytes are pushed one at a time and COBS decoded as they arrive. A record
+ * with a bad CRC, version or length is counted and skipped.
+ */
+class mmWaveStreamDecoder {
+ private:
+  uint8_t _buffer[MMWAVE_STREAM_MAX_RECORD];
+  size_t _length     = 0;
+  uint8_t _code      = 0;  // code byte of the current COBS block
+  uint8_t _remaining = 0;  // data bytes left in the block
+  bool _overflow     = false;
+  uint32_t _errors   = 0;
+  mmWaveStreamRecord _record;
+
+  void append(uint8_t byte);
+  bool decode();
+
+ public:
+  mmWaveStreamDecoder() {}
+
+  void reset();
+  bool push(uint8_t byte);
+
+  /* Valid after push() returned true, until the next push() */
+  const mmWaveStreamRecord& record() const {
+    return _record;
+  }
+  uint32_t errors() const {
+    return _errors;
+  }
+};
+
+#endif /*SEEEDMMWAVE_STREAM_H*/
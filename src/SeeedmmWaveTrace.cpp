@@ -0,0 +1,65 @@
+/**
+ * @file SeeedmmWaveTrace.cpp
+ * @date  18 October 2026
+ *
+ * @note Binary trace of the receive, decode and command paths.
+ *
+ * @copyright © 2024, Seeed Studio
+ */
+
+#include "SeeedmmWaveTrace.h"
+
+#include <string.h>
+
+#if MMWAVE_TRACE
+mmWaveTraceRing mmWaveTracer;
+#endif
+
+static void mmWaveTraceStore(uint8_t* out, uint32_t value, size_t bytes) {
+  for (size_t i = 0; i < bytes; i++) {
+    out[i] = static_cast<uint8_t>(value >> (8 * i));
+  }
+}
+
+/**
+ * @brief Write the events still in the ring, oldest first.
+ *
+ * The header holds, little-endian: u32 magic, u8 version, u8 record size,
+ * u16 reserved, u32 number of records, u32 events overwritten before the
+ * dump. An event recorded while the dump runs may be left out.
+ *
+ * @return The number of bytes written, 0 if `capacity` is below
+ * dumpSize().
+ */
+size_t mmWaveTraceRing::dump(uint8_t* out, size_t capacity) const {
+  uint32_t end   = recorded();
+  uint32_t count = end < MMWAVE_TRACE_EVENTS ? end : MMWAVE_TRACE_EVENTS;
+  if (capacity < MMWAVE_TRACE_HEADER_SIZE + count * sizeof(mmWaveTraceRecord))
+    return 0;
+
+  uint8_t* record = out + MMWAVE_TRACE_HEADER_SIZE;
+  uint32_t kept   = 0;
+  for (uint32_t n = end - count; n != end; n++) {
+    const mmWaveTraceRecord& slot = _records[n & (MMWAVE_TRACE_EVENTS - 1)];
+    mmWaveTraceRecord copy        = slot;
+    // Overwritten or still being written since `end` was read
+    if (copy.sequence != static_cast<uint16_t>(n))
+      continue;
+    mmWaveTraceStore(record, copy.time_us, 4);
+    mmWaveTraceStore(record + 4, copy.type, 2);
+    mmWaveTraceStore(record + 6, copy.length, 2);
+    record[8] = copy.event;
+    record[9] = copy.phase;
+    mmWaveTraceStore(record + 10, copy.sequence, 2);
+    record += sizeof(mmWaveTraceRecord);
+    kept++;
+  }
+
+  mmWaveTraceStore(out, MMWAVE_TRACE_MAGIC, 4);
+  out[4] = MMWAVE_TRACE_VERSION;
+  out[5] = sizeof(mmWaveTraceRecord);
+  mmWaveTraceStore(out + 6, 0, 2);
+  mmWaveTraceStore(out + 8, kept, 4);
+  mmWaveTraceStore(out + 12, end - count, 4);
+  return record - out;
+}
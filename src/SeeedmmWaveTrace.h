@@ -0,0 +1,154 @@
+/**
+ * @file SeeedmmWaveTrace.h
+ * @date  18 October 2026
+ *
+ * @note Binary trace of the receive, decode and command paths.
+ *
+ * @copyright © 2024, Seeed Studio
+ *
+ * @attention With MMWAVE_TRACE set to 1 the library records fixed-size
+ * events into the RAM ring mmWaveTracer: the time in microseconds, what
+ * happened, the frame type and a length. Recording an event is an atomic
+ * increment and a 12-byte store, nothing is printed, so tracing hardly
+ * changes the timing it measures. With MMWAVE_TRACE at 0, the default, the
+ * trace points compile to nothing.
+ *
+ * dump() writes the events still in the ring as a 16-byte header followed
+ * by the events, little-endian. extras/host/trace2chrome.cpp turns a dump
+ * into Chrome trace JSON for chrome://tracing or ui.perfetto.dev.
+ *
+ * @code
+ * static uint8_t dump[16 + 12 * MMWAVE_TRACE_EVENTS];
+ * size_t len = mmWaveTracer.dump(dump, sizeof(dump));
+ * Serial.write(dump, len);
+ * @endcode
+ */
+
+#ifndef SEEEDMMWAVE_TRACE_H
+#define SEEEDMMWAVE_TRACE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+
+#ifndef MMWAVE_TRACE
+#  define MMWAVE_TRACE 0
+#endif
+
+/* Events kept, a power of two, 12 bytes each */
+#ifndef MMWAVE_TRACE_EVENTS
+#  define MMWAVE_TRACE_EVENTS 512
+#endif
+
+static_assert((MMWAVE_TRACE_EVENTS & (MMWAVE_TRACE_EVENTS - 1)) == 0,
+              "MMWAVE_TRACE_EVENTS must be a power of two");
+
+#define MMWAVE_TRACE_MAGIC       0x5254574DUL  // "MWTR"
+#define MMWAVE_TRACE_VERSION     1
+#define MMWAVE_TRACE_HEADER_SIZE 16
+
+enum class mmWaveTraceEvent : uint8_t {
+  Fetch = 1,      // fetch(), length: bytes read
+  FrameReceived,  // the parser completed a frame
+  ProcessFrame,   // processFrame(), from the queue to the decoder
+  HandleType,     // handleType() of the sensor class
+  Send,           // sendBytes(), length: frame size
+  Command,        // fetchType(), waiting for the answer to a command
+  Update,         // update()
+};
+
+/* Chrome trace phases */
+enum class mmWaveTracePhase : uint8_t {
+  Begin   = 'B',
+  End     = 'E',
+  Instant = 'i',
+};
+
+typedef struct mmWaveTraceRecord {
+  uint32_t time_us;
+  uint16_t type;      // frame type, 0xFFFF for none
+  uint16_t length;    // bytes, see mmWaveTraceEvent
+  uint8_t event;      // mmWaveTraceEvent
+  uint8_t phase;      // mmWaveTracePhase
+  uint16_t sequence;  // low bits of the event number, written last
+} mmWaveTraceRecord;
+
+static_assert(sizeof(mmWaveTraceRecord) == 12, "trace records are 12 bytes");
+
+inline const char* mmWaveTraceEventName(uint8_t event) {
+  static const char* const kNames[] = {
+      "unknown",    "fetch", "frameReceived", "processFrame",
+      "handleType", "send",  "command",       "update"};
+  return event < sizeof(kNames) / sizeof(kNames[0]) ? kNames[event]
+                                                    : kNames[0];
+}
+
+/**
+ * @brief Ring of trace events. Any task or interrupt may record, the
+ * oldest events are overwritten.
+ */
+class mmWaveTraceRing {
+ private:
+  mmWaveTraceRecord _records[MMWAVE_TRACE_EVENTS];
+  std::atomic<uint32_t> _next{0};
+
+ public:
+  mmWaveTraceRing() {}
+
+  void record(uint32_t time_us, mmWaveTraceEvent event,
+              mmWaveTracePhase phase, uint16_t type, size_t length) {
+    uint32_t n              = _next.fetch_add(1, std::memory_order_relaxed);
+    mmWaveTraceRecord& slot = _records[n & (MMWAVE_TRACE_EVENTS - 1)];
+
+    slot.time_us = time_us;
+    slot.type    = type;
+    slot.length  = length > 0xFFFF ? 0xFFFF : static_cast<uint16_t>(length);
+    slot.event   = static_cast<uint8_t>(event);
+    slot.phase   = static_cast<uint8_t>(phase);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.sequence = static_cast<uint16_t>(n);
+  }
+
+  /* Events recorded since the last clear(), including overwritten ones */
+  uint32_t recorded() const {
+    return _next.load(std::memory_order_relaxed);
+  }
+  void clear() {
+    _next.store(0, std::memory_order_relaxed);
+  }
+
+  size_t dumpSize() const {
+    uint32_t count = recorded();
+    if (count > MMWAVE_TRACE_EVENTS)
+      count = MMWAVE_TRACE_EVENTS;
+    return MMWAVE_TRACE_HEADER_SIZE + count * sizeof(mmWaveTraceRecord);
+  }
+
+  size_t dump(uint8_t* out, size_t capacity) const;
+};
+
+#if MMWAVE_TRACE
+extern mmWaveTraceRing mmWaveTracer;
+
+#  ifndef MMWAVE_TRACE_CLOCK
+#    define MMWAVE_TRACE_CLOCK() micros()
+#  endif
+
+#  define MMWAVE_TRACE_POINT(event, phase, type, length)                       \
+    mmWaveTracer.record(MMWAVE_TRACE_CLOCK(), mmWaveTraceEvent::event,         \
+                        mmWaveTracePhase::phase, (type), (length))
+#else
+#  define MMWAVE_TRACE_POINT(event, phase, type, length)                       \
+    do {                                                                       \
+    } while (0)
+#endif
+
+#define MMWAVE_TRACE_BEGIN(event, type, length)                                \
+  MMWAVE_TRACE_POINT(event, Begin, type, length)
+#define MMWAVE_TRACE_END(event, type, length)                                  \
+  MMWAVE_TRACE_POINT(event, End, type, length)
+#define MMWAVE_TRACE_INSTANT(event, type, length)                              \
+  MMWAVE_TRACE_POINT(event, Instant, type, length)
+
+#endif /*SEEEDMMWAVE_TRACE_H*/
@@ -0,0 +1,445 @@
+/**
+ * @file SeeedmmWaveUpsample.cpp
+ * @date  18 October 2026
+ *
+ * @note Densify sparse point clouds for display: neighbour midpoints and
+ * moving least squares on local planes.
+ *
+ * @copyright © 2024, Seeed Studio
+ */
+
+#include "SeeedmmWaveUpsample.h"
+
+#include <math.h>
+
+/* Cell coordinates are packed in 10 bits each */
+#define MMWAVE_UPSAMPLE_COORD_BITS 10
+#define MMWAVE_UPSAMPLE_COORD_MAX  1023
+
+#define MMWAVE_UPSAMPLE_PI 3.14159265f
+
+bool mmWaveUpsampler::begin(size_t max_points, uint8_t factor) {
+  if (max_points == 0 || max_points > 0xFFFF || factor < 2)
+    return false;
+  _max_points = max_points;
+  _factor     = factor;
+
+  // About two buckets per point keeps collisions rare
+  size_t buckets = 16;
+  while (buckets < 2 * max_points) {
+    buckets <<= 1;
+  }
+  _start.assign(buckets + 1, 0);
+  _order.assign(max_points, 0);
+  _bucket.assign(max_points, 0);
+  return true;
+}
+
+void mmWaveUpsampler::cellOf(const TargetN& point, int32_t cell[3]) const {
+  const float position[3] = {point.x_point, point.y_point, point.z_point};
+  for (size_t axis = 0; axis < 3; axis++) {
+    float index = (position[axis] - _min[axis]) * _inverse_cell;
+    if (!(index >= 0))  // also NaN
+      index = 0;
+    cell[axis] = index < _cells[axis] ? static_cast<int32_t>(index)
+                                      : _cells[axis] - 1;
+  }
+}
+
+uint32_t mmWaveUpsampler::bucketOf(int32_t x, int32_t y, int32_t z) const {
+  return (static_cast<uint32_t>(x) * 73856093u ^
+          static_cast<uint32_t>(y) * 19349663u ^
+          static_cast<uint32_t>(z) * 83492791u) &
+         _mask;
+}
+
+/* Packed cell coordinates, to tell apart cells sharing a bucket */
+static inline uint32_t mmWaveUpsampleKey(const int32_t cell[3]) {
+  return (static_cast<uint32_t>(cell[0]) << (2 * MMWAVE_UPSAMPLE_COORD_BITS)) |
+         (static_cast<uint32_t>(cell[1]) << MMWAVE_UPSAMPLE_COORD_BITS) |
+         static_cast<uint32_t>(cell[2]);
+}
+
+/**
+ * @brief Bin the points into cells of `cell` metres, a counting sort by
+ * bucket: the points of bucket b are _order[_start[b]] to
+ * _order[_start[b + 1] - 1]. _bucket keeps the packed cell of each point.
+ */
+void mmWaveUpsampler::index(const std::vector<TargetN>& points, float cell) {
+  float max[3];
+  _min[0] = max[0] = points[0].x_point;
+  _min[1] = max[1] = points[0].y_point;
+  _min[2] = max[2] = points[0].z_point;
+  for (const TargetN& point : points) {
+    const float position[3] = {point.x_point, point.y_point, point.z_point};
+    for (size_t axis = 0; axis < 3; axis++) {
+      if (position[axis] < _min[axis])
+        _min[axis] = position[axis];
+      if (position[axis] > max[axis])
+        max[axis] = position[axis];
+    }
+  }
+  _inverse_cell = 1.0f / cell;
+  for (size_t axis = 0; axis < 3; axis++) {
+    float cells = (max[axis] - _min[axis]) * _inverse_cell + 1;
+    _cells[axis] = cells < MMWAVE_UPSAMPLE_COORD_MAX
+                       ? static_cast<int32_t>(cells)
+                       : MMWAVE_UPSAMPLE_COORD_MAX;
+  }
+
+  // The table follows the cloud, a small cloud clears a small table
+  size_t count   = points.size();
+  size_t buckets = 16;
+  while (buckets < 2 * count) {
+    buckets <<= 1;
+  }
+  _mask = buckets - 1;
+  for (size_t b = 0; b <= _mask + 1; b++) {
+    _start[b] = 0;
+  }
+  for (size_t i = 0; i < count; i++) {
+    int32_t at[3];
+    cellOf(points[i], at);
+    _bucket[i] = mmWaveUpsampleKey(at);
+    _start[bucketOf(at[0], at[1], at[2])]++;
+  }
+  // Running sum: _start[b] ends bucket b, filling backwards leaves it at
+  // the start of bucket b
+  for (size_t b = 1; b <= _mask; b++) {
+    _start[b] += _start[b - 1];
+  }
+  _start[_mask + 1] = count;
+  for (size_t i = count; i-- > 0;) {
+    uint32_t key = _bucket[i];
+    uint32_t b = bucketOf(key >> (2 * MMWAVE_UPSAMPLE_COORD_BITS),
+                          (key >> MMWAVE_UPSAMPLE_COORD_BITS) &
+                              MMWAVE_UPSAMPLE_COORD_MAX,
+                          key & MMWAVE_UPSAMPLE_COORD_MAX);
+    _order[--_start[b]] = i;
+  }
+}
+
+/**
+ * @brief The k nearest neighbours of a point, the point excluded, by
+ * searching rings of cells around it. Ring r holds no point closer than
+ * r cells, so the search ends once the k-th best is within that.
+ *
+ * @return The number found, below k only if the cloud is that small.
+ */
+size_t mmWaveUpsampler::nearest(const std::vector<TargetN>& points,
+                                size_t query, uint8_t k,
+                                uint16_t* found) const {
+  float best[MMWAVE_UPSAMPLE_MAX_K];
+  size_t count = 0;
+
+  const TargetN& p = points[query];
+  int32_t center[3];
+  cellOf(p, center);
+  int32_t rings = _cells[0];
+  if (_cells[1] > rings)
+    rings = _cells[1];
+  if (_cells[2] > rings)
+    rings = _cells[2];
+
+  float cell = 1.0f / _inverse_cell;
+  for (int32_t r = 0; r < rings; r++) {
+    int32_t lo[3], hi[3];
+    for (size_t axis = 0; axis < 3; axis++) {
+      lo[axis] = center[axis] - r < 0 ? 0 : center[axis] - r;
+      hi[axis] = center[axis] + r >= _cells[axis] ? _cells[axis] - 1
+                                                  : center[axis] + r;
+    }
+    for (int32_t x = lo[0]; x <= hi[0]; x++) {
+      for (int32_t y = lo[1]; y <= hi[1]; y++) {
+        bool shell_xy = x == center[0] - r || x == center[0] + r ||
+                        y == center[1] - r || y == center[1] + r;
+        for (int32_t z = lo[2]; z <= hi[2]; z++) {
+          // Only the shell, the inside was searched by smaller rings
+          if (!shell_xy && z != center[2] - r && z != center[2] + r)
+            continue;
+          const int32_t at[3] = {x, y, z};
+          uint32_t key        = mmWaveUpsampleKey(at);
+          uint32_t b          = bucketOf(x, y, z);
+          for (uint16_t e = _start[b]; e < _start[b + 1]; e++) {
+            uint16_t j = _order[e];
+            if (j == query || _bucket[j] != key)
+              continue;
+            float dx = points[j].x_point - p.x_point;
+            float dy = points[j].y_point - p.y_point;
+            float dz = points[j].z_point - p.z_point;
+            float d2 = dx * dx + dy * dy + dz * dz;
+            if (count == k && d2 >= best[k - 1])
+              continue;
+            // Insertion into the sorted best list
+            size_t slot = count < k ? count++ : k - 1;
+            while (slot > 0 && best[slot - 1] > d2) {
+              best[slot]  = best[slot - 1];
+              found[slot] = found[slot - 1];
+              slot--;
+            }
+            best[slot]  = d2;
+            found[slot] = j;
+          }
+        }
+      }
+    }
+    float reach = r * cell;
+    if (count == k && best[k - 1] <= reach * reach)
+      break;
+  }
+  return count;
+}
+
+uint32_t mmWaveUpsampler::random() {
+  _seed ^= _seed << 13;
+  _seed ^= _seed >> 17;
+  _seed ^= _seed << 5;
+  return _seed;
+}
+
+float mmWaveUpsampler::uniform(float lo, float hi) {
+  return lo + (hi - lo) * (random() >> 8) * (1.0f / 16777216.0f);
+}
+
+/* Sum of four uniforms, close enough to a normal distribution for jitter */
+float mmWaveUpsampler::gaussian(float sigma) {
+  if (sigma == 0)
+    return 0;
+  float sum = uniform(0, 1) + uniform(0, 1) + uniform(0, 1) + uniform(0, 1);
+  return sigma * (sum - 2.0f) * 1.7320508f;
+}
+
+size_t mmWaveUpsampler::midpoints(const PeopleCounting& in,
+                                  PeopleCounting& out, uint8_t k) {
+  const std::vector<TargetN>& points = in.targets;
+  out.targets.reserve(capacity());
+  out.targets.assign(points.begin(), points.end());
+  size_t count = points.size();
+  if (count < 2 || count > _max_points)
+    return 0;
+  if (k < 1)
+    k = 1;
+  if (k > MMWAVE_UPSAMPLE_MAX_K)
+    k = MMWAVE_UPSAMPLE_MAX_K;
+
+  // Cells holding about two points each if the cloud filled its box,
+  // along the axes it spans
+  float min[3] = {points[0].x_point, points[0].y_point, points[0].z_point};
+  float max[3] = {min[0], min[1], min[2]};
+  for (const TargetN& point : points) {
+    const float position[3] = {point.x_point, point.y_point, point.z_point};
+    for (size_t axis = 0; axis < 3; axis++) {
+      min[axis] = position[axis] < min[axis] ? position[axis] : min[axis];
+      max[axis] = position[axis] > max[axis] ? position[axis] : max[axis];
+    }
+  }
+  float extent = 0;
+  for (size_t axis = 0; axis < 3; axis++) {
+    if (max[axis] - min[axis] > extent)
+      extent = max[axis] - min[axis];
+  }
+  int dimensions = 0;
+  for (size_t axis = 0; axis < 3; axis++) {
+    dimensions += max[axis] - min[axis] > 0.05f * extent;
+  }
+  float divisions = dimensions ? ceilf(powf(count * 0.5f, 1.0f / dimensions))
+                               : 1;
+  float cell = extent > 0 ? extent / divisions : 1.0f;
+  index(points, cell);
+
+  // People are small next to the room: if the occupied cells are crowded,
+  // size the cells again for about two points each where the points are
+  size_t occupied = 0;
+  for (size_t b = 0; b <= _mask; b++) {
+    occupied += _start[b + 1] != _start[b];
+  }
+  if (dimensions && count > 4 * occupied) {
+    index(points, cell * powf(2.0f * occupied / count, 1.0f / dimensions));
+  }
+
+  uint16_t found[MMWAVE_UPSAMPLE_MAX_K];
+  for (size_t i = 0; i < count; i++) {
+    size_t neighbours = nearest(points, i, k, found);
+    if (neighbours == 0)
+      continue;
+    for (uint8_t n = 1; n < _factor; n++) {
+      size_t a = found[0], b = i;
+      if (neighbours >= 2) {
+        size_t first  = random() % neighbours;
+        size_t second = random() % (neighbours - 1);
+        a             = found[first];
+        b             = found[second >= first ? second + 1 : second];
+      }
+      TargetN point;
+      point.x_point   = (points[a].x_point + points[b].x_point) * 0.5f +
+                      gaussian(_noise);
+      point.y_point   = (points[a].y_point + points[b].y_point) * 0.5f +
+                      gaussian(_noise);
+      point.z_point   = (points[a].z_point + points[b].z_point) * 0.5f +
+                      gaussian(_noise);
+      point.dop_index = (points[a].dop_index + points[b].dop_index) * 0.5f +
+                        gaussian(_doppler);
+      point.cluster_index = points[i].cluster_index;
+      out.targets.push_back(point);
+    }
+  }
+  return out.targets.size() - count;
+}
+
+/**
+ * @brief Eigenvector of the smallest eigenvalue of a symmetric 3x3 matrix,
+ * by cyclic Jacobi rotations. `a` is destroyed.
+ */
+static void mmWaveSmallestEigenvector(float a[3][3], float v[3]) {
+  float vectors[3][3] = {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}};
+  static const uint8_t kPairs[3][2] = {{0, 1}, {0, 2}, {1, 2}};
+  for (int sweep = 0; sweep < 8; sweep++) {
+    float off   = a[0][1] * a[0][1] + a[0][2] * a[0][2] + a[1][2] * a[1][2];
+    float scale = a[0][0] * a[0][0] + a[1][1] * a[1][1] + a[2][2] * a[2][2];
+    if (off <= 1e-12f * scale)
+      break;
+    for (const auto& pair : kPairs) {
+      int p = pair[0], q = pair[1];
+      if (a[p][q] == 0)
+        continue;
+      float theta = (a[q][q] - a[p][p]) / (2 * a[p][q]);
+      float t     = (theta >= 0 ? 1.0f : -1.0f) /
+                (fabsf(theta) + sqrtf(theta * theta + 1));
+      float c = 1.0f / sqrtf(t * t + 1);
+      float s = t * c;
+      for (int k = 0; k < 3; k++) {
+        float kp = a[k][p], kq = a[k][q];
+        a[k][p]  = c * kp - s * kq;
+        a[k][q]  = s * kp + c * kq;
+      }
+      for (int k = 0; k < 3; k++) {
+        float pk = a[p][k], qk = a[q][k];
+        a[p][k]  = c * pk - s * qk;
+        a[q][k]  = s * pk + c * qk;
+      }
+      for (int k = 0; k < 3; k++) {
+        float kp      = vectors[k][p], kq = vectors[k][q];
+        vectors[k][p] = c * kp - s * kq;
+        vectors[k][q] = s * kp + c * kq;
+      }
+    }
+  }
+  int smallest = 0;
+  for (int i = 1; i < 3; i++) {
+    if (a[i][i] < a[smallest][smallest])
+      smallest = i;
+  }
+  for (int k = 0; k < 3; k++) {
+    v[k] = vectors[k][smallest];
+  }
+}
+
+size_t mmWaveUpsampler::mls(const PeopleCounting& in, PeopleCounting& out,
+                            float radius) {
+  const std::vector<TargetN>& points = in.targets;
+  out.targets.reserve(capacity());
+  out.targets.assign(points.begin(), points.end());
+  size_t count = points.size();
+  if (count < 3 || count > _max_points || !(radius > 0))
+    return 0;
+
+  // With cells of one radius every neighbour is in the 27 cells around
+  index(points, radius);
+  float radius2 = radius * radius;
+
+  for (size_t i = 0; i < count; i++) {
+    const TargetN& p = points[i];
+    int32_t center[3];
+    cellOf(p, center);
+
+    // Offsets from p: their sum and products give the covariance
+    size_t neighbours = 0;
+    float sum[3]      = {0, 0, 0};
+    float products[6] = {0, 0, 0, 0, 0, 0};  // xx xy xz yy yz zz
+    float weights = 0, doppler = 0;
+    for (int32_t x = center[0] - 1; x <= center[0] + 1; x++) {
+      for (int32_t y = center[1] - 1; y <= center[1] + 1; y++) {
+        for (int32_t z = center[2] - 1; z <= center[2] + 1; z++) {
+          if (x < 0 || y < 0 || z < 0 || x >= _cells[0] || y >= _cells[1] ||
+              z >= _cells[2])
+            continue;
+          const int32_t at[3] = {x, y, z};
+          uint32_t key        = mmWaveUpsampleKey(at);
+          uint32_t b          = bucketOf(x, y, z);
+          for (uint16_t e = _start[b]; e < _start[b + 1]; e++) {
+            uint16_t j = _order[e];
+            if (j == i || _bucket[j] != key)
+              continue;
+            float dx = points[j].x_point - p.x_point;
+            float dy = points[j].y_point - p.y_point;
+            float dz = points[j].z_point - p.z_point;
+            float d2 = dx * dx + dy * dy + dz * dz;
+            if (d2 >= radius2)
+              continue;
+            neighbours++;
+            sum[0] += dx;
+            sum[1] += dy;
+            sum[2] += dz;
+            products[0] += dx * dx;
+            products[1] += dx * dy;
+            products[2] += dx * dz;
+            products[3] += dy * dy;
+            products[4] += dy * dz;
+            products[5] += dz * dz;
+            float w = 1.0f / (sqrtf(d2) + 1e-10f);
+            weights += w;
+            doppler += w * points[j].dop_index;
+          }
+        }
+      }
+    }
+    if (neighbours < 2)
+      continue;
+
+    float n       = static_cast<float>(neighbours);
+    float mean[3] = {sum[0] / n, sum[1] / n, sum[2] / n};
+    float covariance[3][3];
+    covariance[0][0] = products[0] / n - mean[0] * mean[0];
+    covariance[0][1] = covariance[1][0] = products[1] / n - mean[0] * mean[1];
+    covariance[0][2] = covariance[2][0] = products[2] / n - mean[0] * mean[2];
+    covariance[1][1] = products[3] / n - mean[1] * mean[1];
+    covariance[1][2] = covariance[2][1] = products[4] / n - mean[1] * mean[2];
+    covariance[2][2] = products[5] / n - mean[2] * mean[2];
+    float normal[3];
+    mmWaveSmallestEigenvector(covariance, normal);
+
+    // Two directions spanning the plane
+    float u[3];
+    if (fabsf(normal[0]) > fabsf(normal[1])) {
+      u[0] = normal[2];
+      u[1] = 0;
+      u[2] = -normal[0];
+    } else {
+      u[0] = 0;
+      u[1] = normal[2];
+      u[2] = -normal[1];
+    }
+    float length = sqrtf(u[0] * u[0] + u[1] * u[1] + u[2] * u[2]) + 1e-10f;
+    u[0] /= length;
+    u[1] /= length;
+    u[2] /= length;
+    float w[3] = {normal[1] * u[2] - normal[2] * u[1],
+                  normal[2] * u[0] - normal[0] * u[2],
+                  normal[0] * u[1] - normal[1] * u[0]};
+
+    float speed = doppler / weights;
+    for (uint8_t k = 1; k < _factor; k++) {
+      float angle = uniform(0, 2 * MMWAVE_UPSAMPLE_PI);
+      float r     = uniform(0, radius * 0.5f);
+      float cu = r * cosf(angle), cw = r * sinf(angle);
+      TargetN point;
+      point.x_point       = p.x_point + cu * u[0] + cw * w[0];
+      point.y_point       = p.y_point + cu * u[1] + cw * w[1];
+      point.z_point       = p.z_point + cu * u[2] + cw * w[2];
+      point.dop_index     = speed;
+      point.cluster_index = p.cluster_index;
+      out.targets.push_back(point);
+    }
+  }
+  return out.targets.size() - count;
+}
@@ -0,0 +1,123 @@
+/**
+ * @file SeeedmmWaveUpsample.h
+ * @date  18 October 2026
+ *
+ * @note Densify sparse point clouds for display: neighbour midpoints and
+ * moving least squares on local planes.
+ *
+ * @copyright © 2024, Seeed Studio
+ *
+ * @attention The two methods of PointCloud2dChart_realtime_upsampling.py,
+ * without its O(N^2) searches. Points are binned into a hashed uniform grid
+ * once per call, a counting sort into one index array, so a neighbour query
+ * only visits the cells around a point:
+ * - midpoints(): every point gets `factor - 1` new points halfway between
+ *   two of its k nearest neighbours, found by searching rings of cells
+ *   outwards until no closer point can remain.
+ * - mls(): every point with at least two neighbours within `radius` gets
+ *   `factor - 1` new points on the plane fitted to those neighbours (the
+ *   normal is the eigenvector of their covariance with the smallest
+ *   eigenvalue), within radius / 2 of it. Their doppler is the inverse
+ *   distance weighted doppler of the neighbours.
+ * The output holds the input points first and then the new ones, which
+ * take the cluster of the point they were made for. Small Gaussian noise is
+ * added to new points as in the script; setNoise(0, 0) turns it off.
+ *
+ * begin() allocates every buffer for `max_points` input points. After that
+ * no call allocates, provided the output cloud is reused, so it runs in the
+ * loop() of an ESP32-S3 as well as on a host. Only float math is used.
+ * extras/host/upsample_bench.cpp times both methods from 64 to 4096 points.
+ *
+ * @code
+ * mmWaveUpsampler upsampler;
+ * upsampler.begin(MMWAVE_MAX_POINTS, 3);
+ * ...
+ * if (mmWave.getPeopleCountingPointCloud(cloud))
+ *   upsampler.mls(cloud, dense, 0.15f);
+ * @endcode
+ */
+
+#ifndef SEEEDMMWAVE_UPSAMPLE_H
+#define SEEEDMMWAVE_UPSAMPLE_H
+
+#include "SEEED_Public.h"
+
+/* Nearest neighbours used by midpoints() at most */
+#define MMWAVE_UPSAMPLE_MAX_K 8
+
+class mmWaveUpsampler {
+ private:
+  size_t _max_points = 0;
+  uint8_t _factor    = 3;
+  uint32_t _seed     = 0x9E3779B9;
+  float _noise       = 0.02f;  // metres
+  float _doppler     = 0.1f;
+
+  /* Grid of the current call: points sorted by bucket */
+  float _min[3];
+  float _inverse_cell = 1;
+  int32_t _cells[3];  // grid size per axis
+  uint32_t _mask      = 0;
+  std::vector<uint16_t> _start;   // first entry of each bucket, and the end
+  std::vector<uint16_t> _order;   // point indices sorted by bucket
+  std::vector<uint32_t> _bucket;  // packed cell of each point
+
+  void index(const std::vector<TargetN>& points, float cell);
+  void cellOf(const TargetN& point, int32_t cell[3]) const;
+  uint32_t bucketOf(int32_t x, int32_t y, int32_t z) const;
+  size_t nearest(const std::vector<TargetN>& points, size_t query, uint8_t k,
+                 uint16_t* found) const;
+
+  uint32_t random();
+  float uniform(float lo, float hi);
+  float gaussian(float sigma);
+
+ public:
+  mmWaveUpsampler() {}
+
+  /**
+   * @param max_points Largest input cloud, at most 65535 points.
+   * @param factor Output points per input point, 2 or more.
+   * @retval false `max_points` or `factor` is out of range.
+   */
+  bool begin(size_t max_points, uint8_t factor = 3);
+
+  /* Noise added to new points, standard deviations; 0 for none */
+  void setNoise(float position, float doppler) {
+    _noise   = position;
+    _doppler = doppler;
+  }
+  void setSeed(uint32_t seed) {
+    _seed = seed ? seed : 1;
+  }
+
+  /* Output capacity to reserve in a reused output cloud */
+  size_t capacity() const {
+    return _max_points * _factor;
+  }
+
+  /**
+   * @brief Add points halfway between neighbours of each point.
+   *
+   * @param in The cloud, at most `max_points` points.
+   * @param out Receives the points of `in` and the new points.
+   * @param k Nearest neighbours to pick two from, the point itself not
+   * counted. The script's k = 3 included the point, so it is 2 here.
+   * @return The number of points added.
+   */
+  size_t midpoints(const PeopleCounting& in, PeopleCounting& out,
+                   uint8_t k = 2);
+
+  /**
+   * @brief Add points on planes fitted to the neighbourhood of each point.
+   *
+   * @param in The cloud, at most `max_points` points.
+   * @param out Receives the points of `in` and the new points.
+   * @param radius Neighbourhood radius in metres.
+   * @return The number of points added.
+   */
+  size_t mls(const PeopleCounting& in, PeopleCounting& out,
+             float radius = 0.15f);
+};
+
+#endif /*SEEEDMMWAVE_UPSAMPLE_H*/
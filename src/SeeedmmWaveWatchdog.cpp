@@ -0,0 +1,145 @@
+/**
+ * @file SeeedmmWaveWatchdog.cpp
+ * @date  18 October 2026
+ *
+ * @note Stall detection and staged recovery of the link to the module.
+ *
+ * @copyright © 2024, Seeed Studio
+ */
+
+#include "SeeedmmWaveWatchdog.h"
+
+bool mmWaveLinkWatchdog::watch(uint16_t type, uint32_t timeout_ms,
+                               uint32_t now) {
+  for (uint8_t i = 0; i < _stream_count; i++) {
+    if (_streams[i].type != type)
+      continue;
+    if (timeout_ms == 0) {
+      _streams[i] = _streams[--_stream_count];
+      _state      = State::Healthy;
+    } else {
+      _streams[i].timeout_ms = timeout_ms;
+    }
+    return true;
+  }
+  if (timeout_ms == 0)
+    return true;
+  if (_stream_count == MMWAVE_WATCH_STREAMS)
+    return false;
+  Stream& added    = _streams[_stream_count++];
+  added.type       = type;
+  added.probed     = false;
+  added.timeout_ms = timeout_ms;
+  added.last_ms    = now;
+  return true;
+}
+
+void mmWaveLinkWatchdog::observe(uint16_t type, uint32_t now) {
+  for (uint8_t i = 0; i < _stream_count; i++) {
+    Stream& stream = _streams[i];
+    if (stream.type == type || stream.type == MMWAVE_WATCH_LINK) {
+      stream.last_ms = now;
+      stream.probed  = false;
+    }
+  }
+}
+
+mmWaveWatchdogAction mmWaveLinkWatchdog::poll(uint32_t now, bool can_probe) {
+  switch (_state) {
+    case State::Healthy: {
+      mmWaveWatchdogAction action = mmWaveWatchdogAction::None;
+      for (uint8_t i = 0; i < _stream_count; i++) {
+        Stream& stream  = _streams[i];
+        uint32_t silent = now - stream.last_ms;
+        if (silent >= stream.timeout_ms) {
+          _stalled  = i;
+          _stall_ms = now;
+          _stats.stalls++;
+          emit(mmWaveWatchdogEvent::Stalled, now);
+          _state        = State::Flushed;
+          _step_ms      = now;
+          stream.probed = false;  // ask once more after the flush
+          _stats.flushes++;
+          emit(mmWaveWatchdogEvent::Flushed, now);
+          return mmWaveWatchdogAction::Flush;
+        }
+        if (can_probe && stream.type == MMWAVE_WATCH_LINK && !stream.probed &&
+            silent >= stream.timeout_ms / 2) {
+          stream.probed = true;
+          action        = mmWaveWatchdogAction::Probe;
+        }
+      }
+      return action;
+    }
+    case State::Flushed: {
+      Stream& stream = _streams[_stalled];
+      // Signed, the last frame may be older than the flush
+      if (static_cast<int32_t>(stream.last_ms - _step_ms) >= 0) {
+        recover(now);
+        return mmWaveWatchdogAction::None;
+      }
+      if (now - _step_ms < MMWAVE_WATCHDOG_FLUSH_MS) {
+        if (!can_probe || stream.probed)
+          return mmWaveWatchdogAction::None;
+        stream.probed = true;
+        return mmWaveWatchdogAction::Probe;
+      }
+      _state   = State::Restarting;
+      _step_ms = now;
+      _stats.restarts++;
+      emit(mmWaveWatchdogEvent::Restarted, now);
+      return mmWaveWatchdogAction::Restart;
+    }
+    case State::Restarting:
+      return mmWaveWatchdogAction::None;
+    case State::Backoff:
+      if (now - _step_ms < MMWAVE_WATCHDOG_RETRY_MS)
+        return mmWaveWatchdogAction::None;
+      _state                    = State::Flushed;
+      _step_ms                  = now;
+      _streams[_stalled].probed = false;
+      _stats.flushes++;
+      emit(mmWaveWatchdogEvent::Flushed, now);
+      return mmWaveWatchdogAction::Flush;
+  }
+  return mmWaveWatchdogAction::None;
+}
+
+void mmWaveLinkWatchdog::restarted(bool found, uint32_t now) {
+  if (_state != State::Restarting)
+    return;
+  if (found) {
+    recover(now);
+    return;
+  }
+  _state   = State::Backoff;
+  _step_ms = now;
+  _stats.failures++;
+  emit(mmWaveWatchdogEvent::Failed, now);
+}
+
+/* Every stream starts a fresh timeout, the restart may have taken long */
+void mmWaveLinkWatchdog::recover(uint32_t now) {
+  for (uint8_t i = 0; i < _stream_count; i++) {
+    _streams[i].last_ms = now;
+    _streams[i].probed  = false;
+  }
+  _state = State::Healthy;
+  _stats.recoveries++;
+  _stats.last_recovery_ms = now - _stall_ms;
+  emit(mmWaveWatchdogEvent::Recovered, now);
+}
+
+void mmWaveLinkWatchdog::emit(mmWaveWatchdogEvent event, uint32_t now) {
+  if (_on_event)
+    _on_event(event, _streams[_stalled].type, now - _stall_ms,
+              _event_context);
+}
+
+uint32_t mmWaveLinkWatchdog::silentMs(uint16_t type, uint32_t now) const {
+  for (uint8_t i = 0; i < _stream_count; i++) {
+    if (_streams[i].type == type)
+      return now - _streams[i].last_ms;
+  }
+  return 0;
+}
@@ -0,0 +1,165 @@
+/**
+ * @file SeeedmmWaveWatchdog.h
+ * @date  18 October 2026
+ *
+ * @note Stall detection and staged recovery of the link to the module.
+ *
+ * @attention Each watched stream remembers when its last valid frame came
+ * in: the link, any frame at all, or one frame type such as the point
+ * cloud. A stream silent for longer than its timeout is a stall, and the
+ * recovery escalates in bounded steps:
+ * 1. Flush: the receive buffer, the parser and the frame queue are
+ *    emptied. If the stream speaks again within MMWAVE_WATCHDOG_FLUSH_MS
+ *    the link is back.
+ * 2. Restart: the reset pin, if any, is pulsed and the configuration
+ *    queued with queueConfig() is sent again, by the bring-up of
+ *    SeeedmmWave::beginAsync(), within MMWAVE_BRINGUP_TIMEOUT_MS.
+ * 3. If the module still does not answer, the recovery starts over after
+ *    MMWAVE_WATCHDOG_RETRY_MS.
+ * A module that reports nothing by itself while the room is empty would
+ * look stalled; when the sensor class has a probe frame the link is probed
+ * after half its timeout of silence. This header does not depend on
+ * Arduino, the caller passes the time and carries out the actions.
+ *
+ * @copyright © 2024, Seeed Studio
+ */
+
+#ifndef SEEEDMMWAVE_WATCHDOG_H
+#define SEEEDMMWAVE_WATCHDOG_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Streams watched, the link and frame types */
+#ifndef MMWAVE_WATCH_STREAMS
+#  define MMWAVE_WATCH_STREAMS 4
+#endif
+
+/* Time for a stalled stream to speak again after the flush */
+#ifndef MMWAVE_WATCHDOG_FLUSH_MS
+#  define MMWAVE_WATCHDOG_FLUSH_MS 1000
+#endif
+
+/* Pause before a failed recovery starts over */
+#ifndef MMWAVE_WATCHDOG_RETRY_MS
+#  define MMWAVE_WATCHDOG_RETRY_MS 10000
+#endif
+
+/* The stream of any frame type */
+#define MMWAVE_WATCH_LINK 0xFFFF
+
+enum class mmWaveWatchdogEvent : uint8_t {
+  Stalled,    // a stream was silent for longer than its timeout
+  Flushed,    // receive buffer, parser and queue were emptied
+  Restarted,  // the reset pin was pulsed, the configuration is being resent
+  Recovered,  // the stream speaks again
+  Failed,     // the restart found no module, retried later
+};
+
+/* What the owner of the watchdog has to do */
+enum class mmWaveWatchdogAction : uint8_t {
+  None,
+  Probe,    // send the probe frame
+  Flush,    // empty the receive path
+  Restart,  // reset the module and resend the configuration
+};
+
+typedef struct mmWaveWatchdogStats {
+  uint32_t stalls;
+  uint32_t flushes;
+  uint32_t restarts;
+  uint32_t recoveries;
+  uint32_t failures;
+  uint32_t last_recovery_ms;  // from the stall to the last recovery
+} mmWaveWatchdogStats;
+
+/**
+ * @brief Called on each step of a recovery. `type` is the stalled stream,
+ * MMWAVE_WATCH_LINK for the link, and `elapsed_ms` the time since the
+ * stall was detected.
+ */
+typedef void (*mmWaveWatchdogCallback)(mmWaveWatchdogEvent event,
+                                       uint16_t type, uint32_t elapsed_ms,
+                                       void* context);
+
+class mmWaveLinkWatchdog {
+ private:
+  enum class State : uint8_t {
+    Healthy,
+    Flushed,     // waiting for the stream after the flush
+    Restarting,  // the owner restarts the module
+    Backoff,     // waiting to start over
+  };
+
+  struct Stream {
+    uint16_t type;
+    bool probed;  // since the last frame
+    uint32_t timeout_ms;
+    uint32_t last_ms;  // last valid frame
+  };
+
+  Stream _streams[MMWAVE_WATCH_STREAMS];
+  uint8_t _stream_count      = 0;
+  State _state               = State::Healthy;
+  uint8_t _stalled           = 0;  // index of the stalled stream
+  uint32_t _stall_ms         = 0;  // when the stall was detected
+  uint32_t _step_ms          = 0;  // when the current step began
+  mmWaveWatchdogStats _stats = {};
+
+  mmWaveWatchdogCallback _on_event = nullptr;
+  void* _event_context             = nullptr;
+
+  void emit(mmWaveWatchdogEvent event, uint32_t now);
+  void recover(uint32_t now);
+
+ public:
+  mmWaveLinkWatchdog() {}
+
+  /**
+   * @brief Watch a stream, or change its timeout.
+   *
+   * @param type A frame type, or MMWAVE_WATCH_LINK for any frame.
+   * @param timeout_ms Silence taken as a stall, 0 to stop watching it.
+   * @param now The current time in milliseconds.
+   * @retval false MMWAVE_WATCH_STREAMS streams are already watched.
+   */
+  bool watch(uint16_t type, uint32_t timeout_ms, uint32_t now);
+  void clear() {
+    _stream_count = 0;
+    _state        = State::Healthy;
+  }
+  bool enabled() const {
+    return _stream_count > 0;
+  }
+  bool restarting() const {
+    return _state == State::Restarting;
+  }
+
+  void setCallback(mmWaveWatchdogCallback callback, void* context = nullptr) {
+    _on_event      = callback;
+    _event_context = context;
+  }
+
+  /* A valid frame of `type` was received */
+  void observe(uint16_t type, uint32_t now);
+
+  /**
+   * @brief Check the streams and step the recovery.
+   *
+   * @param can_probe The owner has a probe frame to send.
+   * @return What the owner has to do now.
+   */
+  mmWaveWatchdogAction poll(uint32_t now, bool can_probe);
+
+  /* The restart asked for by poll() ended, with the module found or not */
+  void restarted(bool found, uint32_t now);
+
+  /* Time since the last frame of a watched stream, 0 if not watched */
+  uint32_t silentMs(uint16_t type, uint32_t now) const;
+
+  const mmWaveWatchdogStats& stats() const {
+    return _stats;
+  }
+};
+
+#endif /*SEEEDMMWAVE_WATCHDOG_H*/
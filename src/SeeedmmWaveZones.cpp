@@ -0,0 +1,162 @@
+/**
+ * @file SeeedmmWaveZones.cpp
+ * @date  18 October 2026
+ *
+ * @note Per-zone occupancy counting on the floor plane.
+ *
+ * @copyright © 2024, Seeed Studio
+ */
+
+#include "SeeedmmWaveZones.h"
+
+#include <math.h>
+#include <string.h>
+
+/**
+ * @brief Set the area covered by the lookup grid and remove every zone.
+ *
+ * @retval false The area is empty.
+ */
+bool mmWaveZoneMap::begin(float x_min, float y_min, float x_max,
+                          float y_max) {
+  if (!(x_max > x_min && y_max > y_min))
+    return false;
+  _x_min      = x_min;
+  _y_min      = y_min;
+  _x_scale    = MMWAVE_ZONE_GRID / (x_max - x_min);
+  _y_scale    = MMWAVE_ZONE_GRID / (y_max - y_min);
+  _zone_count = 0;
+  memset(_cells, 0, sizeof(_cells));
+  memset(&_summary, 0, sizeof(_summary));
+  return true;
+}
+
+/**
+ * @brief Add a zone.
+ *
+ * @param vertices The corners of the polygon in order, it is closed
+ * implicitly. Self-intersecting polygons are filled by the even-odd rule.
+ * @param count 3 to MMWAVE_ZONE_MAX_VERTICES.
+ * @param enter_frames Frames with a target before the zone is occupied.
+ * @param exit_frames Frames without a target before it is vacant again.
+ * @return The zone number, its bit in the masks, or -1 if the polygon is
+ * invalid or MMWAVE_ZONE_MAX_ZONES are set.
+ */
+int8_t mmWaveZoneMap::addZone(const mmWaveZoneVertex* vertices, uint8_t count,
+                              uint8_t enter_frames, uint8_t exit_frames) {
+  if (_zone_count == MMWAVE_ZONE_MAX_ZONES || count < 3 ||
+      count > MMWAVE_ZONE_MAX_VERTICES)
+    return -1;
+
+  uint8_t index     = _zone_count++;
+  Zone& zone        = _zones[index];
+  zone.enter_frames = enter_frames ? enter_frames : 1;
+  zone.exit_frames  = exit_frames ? exit_frames : 1;
+  zone.streak       = 0;
+  zone.entered_ms   = 0;
+  zone.last_stay    = 0;
+  rasterise(vertices, count, 1 << index);
+  return index;
+}
+
+/* Scanline fill: per row, the edges crossing the row centre give the spans
+ * of cell centres inside the polygon */
+void mmWaveZoneMap::rasterise(const mmWaveZoneVertex* vertices, uint8_t count,
+                              uint8_t bit) {
+  float crossings[MMWAVE_ZONE_MAX_VERTICES];
+  for (int row = 0; row < MMWAVE_ZONE_GRID; row++) {
+    float y   = _y_min + (row + 0.5f) / _y_scale;
+    uint8_t n = 0;
+    for (uint8_t i = 0, j = count - 1; i < count; j = i++) {
+      const mmWaveZoneVertex& a = vertices[i];
+      const mmWaveZoneVertex& b = vertices[j];
+      if ((a.y > y) == (b.y > y))
+        continue;
+      float x = a.x + (y - a.y) * (b.x - a.x) / (b.y - a.y);
+      // Insertion sort, there are only a few crossings per row
+      uint8_t k = n++;
+      for (; k > 0 && crossings[k - 1] > x; k--) {
+        crossings[k] = crossings[k - 1];
+      }
+      crossings[k] = x;
+    }
+
+    uint8_t* cells = _cells + row * MMWAVE_ZONE_GRID;
+    for (uint8_t i = 0; i + 1 < n; i += 2) {
+      // Cells whose centre lies in [crossings[i], crossings[i + 1])
+      float first = ceilf((crossings[i] - _x_min) * _x_scale - 0.5f);
+      float last  = ceilf((crossings[i + 1] - _x_min) * _x_scale - 0.5f);
+      if (first < 0)
+        first = 0;
+      if (last > MMWAVE_ZONE_GRID)
+        last = MMWAVE_ZONE_GRID;
+      for (int cell = static_cast<int>(first); cell < last; cell++) {
+        cells[cell] |= bit;
+      }
+    }
+  }
+}
+
+void mmWaveZoneMap::hysteresis(uint8_t zone, bool present, uint32_t now) {
+  Zone& state   = _zones[zone];
+  uint8_t bit   = 1 << zone;
+  bool occupied = _summary.occupied & bit;
+  if (present == occupied) {
+    state.streak = 0;
+    return;
+  }
+
+  if (state.streak++ == 0)
+    state.streak_start = now;
+  if (state.streak < (present ? state.enter_frames : state.exit_frames))
+    return;
+
+  state.streak = 0;
+  if (present) {
+    _summary.occupied |= bit;
+    _summary.entered |= bit;
+    state.entered_ms = state.streak_start;
+  } else {
+    _summary.occupied &= ~bit;
+    _summary.exited |= bit;
+    state.last_stay = state.streak_start - state.entered_ms;
+  }
+}
+
+/**
+ * @brief Count the targets of a frame per zone and update the occupancy.
+ *
+ * @param now The timestamp of the frame, in ms.
+ * @param targets The targets of the frame.
+ * @return The summary of the frame, valid until the next call.
+ */
+const mmWaveZoneSummary& mmWaveZoneMap::onTargets(
+    uint32_t now, const PeopleCounting& targets) {
+  _summary.timestamp_ms = now;
+  _summary.entered      = 0;
+  _summary.exited       = 0;
+  _summary.outside      = 0;
+  memset(_summary.counts, 0, sizeof(_summary.counts));
+
+  for (size_t i = 0; i < targets.targets.size(); i++) {
+    const TargetN& target = targets.targets[i];
+    uint8_t mask          = lookup(target.x_point, target.y_point);
+    if (mask == 0 && _summary.outside < 255)
+      _summary.outside++;
+    for (uint8_t zone = 0; mask != 0; zone++, mask >>= 1) {
+      if ((mask & 1) && _summary.counts[zone] < 255)
+        _summary.counts[zone]++;
+    }
+  }
+
+  for (uint8_t zone = 0; zone < _zone_count; zone++) {
+    hysteresis(zone, _summary.counts[zone] > 0, now);
+  }
+  return _summary;
+}
+
+uint32_t mmWaveZoneMap::dwellMs(uint8_t zone, uint32_t now) const {
+  if (zone >= _zone_count || !(_summary.occupied & (1 << zone)))
+    return 0;
+  return now - _zones[zone].entered_ms;
+}
@@ -0,0 +1,138 @@
+/**
+ * @file SeeedmmWaveZones.h
+ * @date  18 October 2026
+ *
+ * @note Per-zone occupancy counting on the floor plane.
+ *
+ * @copyright © 2024, Seeed Studio
+ *
+ * @attention Zones are polygons in x/y, in metres as reported by the
+ * sensor. addZone() rasterises a polygon once into a grid of
+ * MMWAVE_ZONE_GRID x MMWAVE_ZONE_GRID cells over the area given to begin();
+ * every cell holds a bitmask of the zones covering its centre, so zones may
+ * overlap and classifying a target is one table read. Zone borders are
+ * resolved to one cell, 6 cm over a 4 x 4 m area.
+ *
+ * A zone becomes occupied once it has held a target for `enter_frames`
+ * frames in a row and vacant once it has been empty for `exit_frames`
+ * frames in a row, so a target flickering at a border does not produce a
+ * stream of enter and exit events. Feed it the target info reports, which
+ * hold one entry per tracked person, rather than the raw point cloud.
+ *
+ * @code
+ * static const mmWaveZoneVertex bed[] = {{-1.0f, 0.5f}, {0.0f, 0.5f},
+ *                                        {0.0f, 2.5f}, {-1.0f, 2.5f}};
+ * zones.begin(-2.0f, 0.0f, 2.0f, 4.0f);
+ * int8_t bed_zone = zones.addZone(bed, 4);
+ * ...
+ * if (mmWave.getPeopleCountingTartgetInfo(targets)) {
+ *   const mmWaveZoneSummary& summary = zones.onTargets(millis(), targets);
+ *   if (summary.entered & (1 << bed_zone)) ...
+ * }
+ * @endcode
+ */
+
+#ifndef SEEEDMMWAVE_ZONES_H
+#define SEEEDMMWAVE_ZONES_H
+
+#include "SEEED_Public.h"
+
+/* Zones per map, one bit each in a grid cell */
+#ifndef MMWAVE_ZONE_MAX_ZONES
+#  define MMWAVE_ZONE_MAX_ZONES 8
+#endif
+
+/* Corners per polygon */
+#ifndef MMWAVE_ZONE_MAX_VERTICES
+#  define MMWAVE_ZONE_MAX_VERTICES 12
+#endif
+
+/* Cells per side of the lookup grid, one byte each */
+#ifndef MMWAVE_ZONE_GRID
+#  define MMWAVE_ZONE_GRID 64
+#endif
+
+static_assert(MMWAVE_ZONE_MAX_ZONES > 0 && MMWAVE_ZONE_MAX_ZONES <= 8,
+              "MMWAVE_ZONE_MAX_ZONES must be 1..8");
+
+typedef struct mmWaveZoneVertex {
+  float x;
+  float y;
+} mmWaveZoneVertex;
+
+/* Result of one frame, bit n of a mask is zone n */
+typedef struct mmWaveZoneSummary {
+  uint32_t timestamp_ms;
+  uint8_t occupied;  // zones occupied after hysteresis
+  uint8_t entered;   // zones that became occupied with this frame
+  uint8_t exited;    // zones that became vacant with this frame
+  uint8_t outside;   // targets in no zone, saturated at 255
+  uint8_t counts[MMWAVE_ZONE_MAX_ZONES];  // targets per zone in this frame
+} mmWaveZoneSummary;
+
+class mmWaveZoneMap {
+ private:
+  struct Zone {
+    uint8_t enter_frames;
+    uint8_t exit_frames;
+    uint8_t streak;         // frames in a row against the current state
+    uint32_t streak_start;  // timestamp of the first of them
+    uint32_t entered_ms;    // start of the current stay
+    uint32_t last_stay;     // length of the previous stay, ms
+  };
+
+  uint8_t _cells[MMWAVE_ZONE_GRID * MMWAVE_ZONE_GRID];
+  Zone _zones[MMWAVE_ZONE_MAX_ZONES];
+  uint8_t _zone_count = 0;
+
+  float _x_min   = 0;
+  float _y_min   = 0;
+  float _x_scale = 0;  // cells per metre
+  float _y_scale = 0;
+
+  mmWaveZoneSummary _summary;
+
+  void rasterise(const mmWaveZoneVertex* vertices, uint8_t count,
+                 uint8_t bit);
+  void hysteresis(uint8_t zone, bool present, uint32_t now);
+
+ public:
+  mmWaveZoneMap() {
+    begin(-3.0f, 0.0f, 3.0f, 6.0f);
+  }
+
+  bool begin(float x_min, float y_min, float x_max, float y_max);
+
+  int8_t addZone(const mmWaveZoneVertex* vertices, uint8_t count,
+                 uint8_t enter_frames = 2, uint8_t exit_frames = 10);
+  uint8_t zoneCount() const {
+    return _zone_count;
+  }
+
+  /* Zones covering a point, 0 outside of every zone */
+  uint8_t lookup(float x, float y) const {
+    float cx = (x - _x_min) * _x_scale;
+    float cy = (y - _y_min) * _y_scale;
+    if (!(cx >= 0 && cx < MMWAVE_ZONE_GRID && cy >= 0 &&
+          cy < MMWAVE_ZONE_GRID))
+      return 0;
+    return _cells[static_cast<size_t>(cy) * MMWAVE_ZONE_GRID +
+                  static_cast<size_t>(cx)];
+  }
+
+  const mmWaveZoneSummary& onTargets(uint32_t now,
+                                     const PeopleCounting& targets);
+  const mmWaveZoneSummary& summary() const {
+    return _summary;
+  }
+
+  /* Time spent in the zone since it became occupied, 0 while vacant */
+  uint32_t dwellMs(uint8_t zone, uint32_t now) const;
+  /* Length of the last completed stay, from the first frame with a target
+   * to the first frame without one */
+  uint32_t lastStayMs(uint8_t zone) const {
+    return zone < _zone_count ? _zones[zone].last_stay : 0;
+  }
+};
+
+#endif /*SEEEDMMWAVE_ZONES_H*/